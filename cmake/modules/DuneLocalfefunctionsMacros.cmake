@@ -6,3 +6,18 @@
 find_package(Eigen3 3.4.90 REQUIRED)
 
 # if(Eigen3_FOUND) option(LOCALFEFUNCTIONS_USE_EIGEN 0) endif()
+
+# The linear algebra backend, which is Eigen by default as in the
+# CMakeLists.txt of dune-localfefunctions. It is also set here, such that the
+# config.h of dependent modules selects the same DefaultLinearAlgebra.
+if(NOT DEFINED DUNE_LOCALFEFUNCTIONS_USE_EIGEN)
+  set(DUNE_LOCALFEFUNCTIONS_USE_EIGEN True)
+endif()
+
+# A dune-localfefunctions built with DUNE_LOCALFEFUNCTIONS_ENABLE_LIBRARY
+# contains the explicit instantiations of the cached Lagrange bases, see
+# cachedlocalBasisInstantiations.hh. Then the config.h of this and of all
+# dependent modules declares them extern.
+if(DUNE_LOCALFEFUNCTIONS_ENABLE_LIBRARY OR dune-localfefunctions_LIBRARIES)
+  set(DUNE_LOCALFEFUNCTIONS_EXPLICIT_INSTANTIATIONS True)
+endif()
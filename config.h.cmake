@@ -49,6 +49,13 @@
 /* Defines a variable to use Eigen for LinearAlgebra */
 #cmakedefine DUNE_LOCALFEFUNCTIONS_USE_EIGEN 1
 
+/* Defines a variable to record call counts and timings of all evaluations, see evaluationProfiler.hh */
+#cmakedefine DUNE_LOCALFEFUNCTIONS_ENABLE_PROFILING 1
+
+/* Defines a variable to use the explicit instantiations of the library dune-localfefunctions, see
+   cachedlocalBasisInstantiations.hh */
+#cmakedefine DUNE_LOCALFEFUNCTIONS_EXPLICIT_INSTANTIATIONS 1
+
 /* end dune-localfefunctions
    Everything below here will be overwritten
 */
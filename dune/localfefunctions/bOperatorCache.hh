@@ -0,0 +1,78 @@
+// SPDX-FileCopyrightText: 2022 The dune-localfefunction developers mueller@ibb.uni-stuttgart.de
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#pragma once
+
+#include <cassert>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <span>
+#include <typeindex>
+#include <vector>
+
+namespace Dune {
+
+  /** \brief Storage of the B-operators, i.e. the derivatives of a strain measure w.r.t. the coefficients, at all
+   * integration points of an element.
+   *
+   * The B-operators of all ansatz functions at one integration point are stored contiguously. The stored operators
+   * remember the geometry, the binding of the basis, see CachedLocalBasis::bindingId(), the id of the leaf node and the
+   * transformation they were computed for. Thus, copies of the basis hit the cache, whereas a rebound basis misses.
+   */
+  template <typename BOperator>
+  class BOperatorCache {
+  public:
+    /** \brief Returns true if the stored B-operators were computed for the given geometry, basis, leaf node id and
+     * transformation */
+    template <typename Geometry, typename Basis, typename Transform>
+    bool isBoundTo(const std::shared_ptr<const Geometry>& geometry, const Basis& basis, std::size_t leafNodeId,
+                   const Transform&) const {
+      return key and key->geometry == geometry and key->basisBinding == basis.bindingId()
+             and key->leafNodeId == leafNodeId and key->transformation == std::type_index(typeid(Transform));
+    }
+
+    /** \brief Marks the stored B-operators as computed for the given geometry, basis, leaf node id and
+     * transformation */
+    template <typename Geometry, typename Basis, typename Transform>
+    void setBoundTo(const std::shared_ptr<const Geometry>& geometry, const Basis& basis, std::size_t leafNodeId,
+                    const Transform&) {
+      key = Key{geometry, basis.bindingId(), leafNodeId, std::type_index(typeid(Transform))};
+    }
+
+    /** \brief Marks the stored B-operators as not belonging to any element */
+    void invalidate() { key.reset(); }
+
+    /** \brief Resizes the storage, the content is unspecified afterwards */
+    void resize(std::size_t integrationPointSize, std::size_t numberOfNodes) {
+      nodes = numberOfNodes;
+      bOperators.resize(integrationPointSize * numberOfNodes);
+    }
+
+    BOperator& operator()(std::size_t ipIndex, std::size_t nodeIndex) {
+      return bOperators[ipIndex * nodes + nodeIndex];
+    }
+    const BOperator& operator()(std::size_t ipIndex, std::size_t nodeIndex) const {
+      return bOperators[ipIndex * nodes + nodeIndex];
+    }
+
+    /** \brief Returns the B-operators of all ansatz functions at the given integration point */
+    std::span<const BOperator> bOperatorsAt(std::size_t ipIndex) const {
+      assert(key && "The B-operator cache is not bound");
+      return {bOperators.data() + ipIndex * nodes, nodes};
+    }
+
+  private:
+    struct Key {
+      std::shared_ptr<const void> geometry;
+      std::uint64_t basisBinding;
+      std::size_t leafNodeId;
+      std::type_index transformation;
+    };
+
+    std::vector<BOperator> bOperators;
+    std::size_t nodes{0};
+    std::optional<Key> key;
+  };
+
+}  // namespace Dune
@@ -0,0 +1,219 @@
+// SPDX-FileCopyrightText: 2022 The dune-localfefunction developers mueller@ibb.uni-stuttgart.de
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/*
+ * Compares the analytic derivatives of an expression with the ones obtained by rebinding it to autodiff::dual2nd, as
+ * it is done by testLocalFunction() for the reference values. The expression is selected at compile time by
+ * BENCHMARK_EXPRESSION, see the CMakeLists.txt, and it is benchmarked on lines, quadrilaterals and hexahedra with
+ * linear and quadratic ansatz functions and with RealTuple and UnitVector coefficients.
+ *
+ * The derivative orders are the derivatives w.r.t. all coefficients (1), w.r.t. all pairs of coefficients along a
+ * vector (2) and additionally w.r.t. all spatial directions along a matrix (3). For autodiff these are the gradient,
+ * the Hessian and the Hessian of the spatial derivative. Note that for UnitVector the analytic derivatives are taken
+ * w.r.t. the tangent space, while autodiff differentiates w.r.t. the embedding.
+ *
+ * Usage: benchmarkAutodiff<Expression> [results.csv|results.json]
+ */
+
+#include <config.h>
+
+#include "../test/testexpression.hh"
+#include "benchmarkHelper.hh"
+
+#include <dune/localfefunctions/expressions.hh>
+#include <dune/localfefunctions/manifolds/realTuple.hh>
+#include <dune/localfefunctions/manifolds/unitVector.hh>
+
+template <int dim>
+using RealT = Dune::RealTuple<double, dim>;
+template <int dim>
+using UnitT = Dune::UnitVector<double, dim>;
+
+using Dune::Benchmark::BenchmarkResults;
+
+template <typename LF>
+void benchmarkDerivatives(const std::string& expression, const LF& lf, int lagrangeOrder, BenchmarkResults& results) {
+  using namespace Dune;
+  using namespace Dune::DerivativeDirections;
+  using Benchmark::doNotOptimizeAway;
+  const auto& coeffs                   = lf.node().coefficientsRef();
+  const size_t coeffSize               = coeffs.size();
+  using Manifold                       = typename std::remove_cvref_t<decltype(coeffs)>::value_type;
+  constexpr int gridDim                = LF::gridDim;
+  constexpr int localFunctionValueSize = LF::Traits::valueSize;
+  constexpr int coeffValueSize         = Manifold::valueSize;
+  const auto alongVec                  = createOnesVector<double, localFunctionValueSize>();
+  const auto alongMat                  = createOnesMatrix<double, localFunctionValueSize, gridDim>();
+
+  int integrationPoints = 0;
+  for ([[maybe_unused]] const auto& [ipIndex, ip] : lf.viewOverIntegrationPoints())
+    ++integrationPoints;
+
+  /* Some expressions do not implement spatial derivatives and throw, then the third derivatives are skipped */
+  bool spatialImplemented = true;
+  try {
+    doNotOptimizeAway(lf.evaluateDerivative(0, wrt(spatialAll), on(gridElement)));
+  } catch (const Dune::NotImplemented&) {
+    spatialImplemented = false;
+  }
+
+  auto analytic = [&](int derivativeOrder) {
+    for (const auto& [ipIndex, ip] : lf.viewOverIntegrationPoints())
+      for (size_t i = 0; i < coeffSize; ++i) {
+        if (derivativeOrder == 1) {
+          doNotOptimizeAway(lf.evaluateDerivative(ipIndex, wrt(coeff(i)), on(gridElement)));
+          continue;
+        }
+        for (size_t j = 0; j < coeffSize; ++j)
+          if (derivativeOrder == 2)
+            doNotOptimizeAway(lf.evaluateDerivative(ipIndex, wrt(coeff(i, j)), along(alongVec), on(gridElement)));
+          else
+            doNotOptimizeAway(
+                lf.evaluateDerivative(ipIndex, wrt(coeff(i, j), spatialAll), along(alongMat), on(gridElement)));
+      }
+  };
+
+  auto& lfDual2nd                  = reusableRebindClone(lf, autodiff::dual2nd());
+  auto lfDual2ndLeafNodeCollection = collectLeafNodeLocalFunctions(lfDual2nd);
+  Eigen::VectorXdual2nd xvr(coeffSize * coeffValueSize);
+  xvr.setZero();
+  Eigen::VectorXd gradient;
+  Eigen::MatrixXd hessian;
+  autodiff::dual2nd u;
+
+  auto automatic = [&](int derivativeOrder) {
+    for (const auto& [ipIndex, ip] : lf.viewOverIntegrationPoints()) {
+      auto localFdual2nd = [&](const auto& x) {
+        lfDual2ndLeafNodeCollection.addToCoeffsInEmbedding(x);
+        auto value = inner(lfDual2nd.evaluate(ipIndex, on(gridElement)), alongVec);
+        lfDual2ndLeafNodeCollection.addToCoeffsInEmbedding(-x);
+        return value;
+      };
+      auto localFdual2ndSpatialAll = [&](const auto& x) {
+        lfDual2ndLeafNodeCollection.addToCoeffsInEmbedding(x);
+        auto value = inner(lfDual2nd.evaluateDerivative(ipIndex, wrt(spatialAll), on(gridElement)), alongMat);
+        lfDual2ndLeafNodeCollection.addToCoeffsInEmbedding(-x);
+        return value;
+      };
+      if (derivativeOrder == 1)
+        gradient = autodiff::gradient(localFdual2nd, autodiff::wrt(xvr), autodiff::at(xvr), u);
+      else if (derivativeOrder == 2)
+        autodiff::hessian(localFdual2nd, autodiff::wrt(xvr), autodiff::at(xvr), u, gradient, hessian);
+      else
+        autodiff::hessian(localFdual2ndSpatialAll, autodiff::wrt(xvr), autodiff::at(xvr), u, gradient, hessian);
+      doNotOptimizeAway(gradient);
+      doNotOptimizeAway(hessian);
+    }
+  };
+
+  const std::string manifold
+      = Std::IsSpecializationTypeAndNonTypes<UnitVector, Manifold>::value ? "UnitVector" : "RealTuple";
+  for (int derivativeOrder = 1; derivativeOrder <= (spatialImplemented ? 3 : 2); ++derivativeOrder)
+    for (const std::string method : {"analytic", "autodiff"}) {
+      const auto measurement = method == "analytic" ? Benchmark::measure([&]() { analytic(derivativeOrder); })
+                                                    : Benchmark::measure([&]() { automatic(derivativeOrder); });
+      results.add({expression,
+                   {{"manifold", manifold},
+                    {"gridDim", std::to_string(gridDim)},
+                    {"worldDim", std::to_string(coeffValueSize)},
+                    {"lagrangeOrder", std::to_string(lagrangeOrder)},
+                    {"coefficients", std::to_string(coeffSize)},
+                    {"derivativeOrder", std::to_string(derivativeOrder)},
+                    {"method", method}},
+                   measurement / integrationPoints});
+    }
+}
+
+/* Sets up the expression on the reference cube of the given dimension in the same way as the expression tests do */
+template <template <int> typename M, int gridDim, int lagrangeOrder, typename Expr>
+void benchmarkOnCube(const std::string& expression, Expr& expr, BenchmarkResults& results) {
+  using namespace Dune::Indices;
+  /* UnitVector in one or two dimensions has a too small tangent space to be interesting */
+  constexpr int worldDim = Dune::Std::IsSpecializationTypeAndNonTypes<Dune::UnitVector, M<3>>::value ? 3 : gridDim;
+  using ManiFoldIDP      = ManiFoldIDPair<M<worldDim>, decltype(_0)>;
+
+  auto exprBenchmark = [&](auto& h, auto&, auto&, [[maybe_unused]] auto& fe) {
+    benchmarkDerivatives(expression, h, lagrangeOrder, results);
+    return TestSuite();
+  };
+
+  using ExprBenchmark = decltype(exprBenchmark);
+  using FC            = decltype(doubleStandardLocalFunctionDouble);
+  localFunctionTestConstructorNew<gridDim, lagrangeOrder, Expr, ExprBenchmark, FC, ManiFoldIDP, ManiFoldIDP, false>(
+      Dune::GeometryTypes::cube(gridDim), expr, exprBenchmark, doubleStandardLocalFunctionDouble);
+}
+
+template <template <int> typename M, typename Expr, int... gridDims>
+void benchmarkExpression(const std::string& expression, Expr& expr, BenchmarkResults& results,
+                         std::integer_sequence<int, gridDims...>) {
+  (benchmarkOnCube<M, gridDims, 1>(expression, expr, results), ...);
+  (benchmarkOnCube<M, gridDims, 2>(expression, expr, results), ...);
+}
+
+constexpr std::integer_sequence<int, 1, 2, 3> allGridDims;
+constexpr std::integer_sequence<int, 2, 3> solidGridDims;
+
+void benchmarkSum(BenchmarkResults& results) {
+  auto expr = [](auto& f, auto& g) { return f + g; };
+  benchmarkExpression<RealT>("Sum", expr, results, allGridDims);
+  benchmarkExpression<UnitT>("Sum", expr, results, allGridDims);
+}
+
+void benchmarkScale(BenchmarkResults& results) {
+  auto expr = [](auto& f, auto&) { return 2.0 * f; };
+  benchmarkExpression<RealT>("Scale", expr, results, allGridDims);
+  benchmarkExpression<UnitT>("Scale", expr, results, allGridDims);
+}
+
+void benchmarkDot(BenchmarkResults& results) {
+  auto expr = [](auto& f, auto& g) { return dot(f, g); };
+  benchmarkExpression<RealT>("Dot", expr, results, allGridDims);
+  benchmarkExpression<UnitT>("Dot", expr, results, allGridDims);
+}
+
+void benchmarkNormSquared(BenchmarkResults& results) {
+  auto expr = [](auto& f, auto&) { return normSquared(f); };
+  benchmarkExpression<RealT>("NormSquared", expr, results, allGridDims);
+  benchmarkExpression<UnitT>("NormSquared", expr, results, allGridDims);
+}
+
+/* f and g share the coefficients, such that the arguments of sqrt and log are positive */
+void benchmarkSqrt(BenchmarkResults& results) {
+  auto expr = [](auto& f, auto& g) { return sqrt(dot(f, g)); };
+  benchmarkExpression<RealT>("Sqrt", expr, results, allGridDims);
+  benchmarkExpression<UnitT>("Sqrt", expr, results, allGridDims);
+}
+
+void benchmarkLog(BenchmarkResults& results) {
+  auto expr = [](auto& f, auto& g) { return log(dot(f, g)); };
+  benchmarkExpression<RealT>("Log", expr, results, allGridDims);
+  benchmarkExpression<UnitT>("Log", expr, results, allGridDims);
+}
+
+void benchmarkPow(BenchmarkResults& results) {
+  auto expr = [](auto& f, auto& g) { return Dune::pow<3>(dot(f, g)); };
+  benchmarkExpression<RealT>("Pow", expr, results, allGridDims);
+  benchmarkExpression<UnitT>("Pow", expr, results, allGridDims);
+}
+
+/* The strains need displacements with the dimension of the grid */
+void benchmarkLinearStrains(BenchmarkResults& results) {
+  auto expr = [](auto& f, auto&) { return linearStrains(f); };
+  benchmarkExpression<RealT>("LinearStrains", expr, results, solidGridDims);
+}
+
+void benchmarkGreenLagrangeStrains(BenchmarkResults& results) {
+  auto expr = [](auto& f, auto&) { return greenLagrangeStrains(f); };
+  benchmarkExpression<RealT>("GreenLagrangeStrains", expr, results, solidGridDims);
+}
+
+int main(int argc, char** argv) {
+  Dune::MPIHelper::instance(argc, argv);
+  BenchmarkResults results;
+
+  BENCHMARK_EXPRESSION(results);
+
+  results.writeCSV(std::cout);
+  if (argc > 1) results.write(argv[1]);
+  return 0;
+}
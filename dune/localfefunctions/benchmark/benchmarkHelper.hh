@@ -0,0 +1,265 @@
+// SPDX-FileCopyrightText: 2022 The dune-localfefunction developers mueller@ibb.uni-stuttgart.de
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#pragma once
+
+#include "../test/allocationCounter.hh"
+#include "perfCounters.hh"
+
+#include <algorithm>
+#include <charconv>
+#include <cstdlib>
+#include <chrono>
+#include <cmath>
+#include <fstream>
+#include <memory>
+#include <numeric>
+#include <optional>
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <dune/geometry/multilineargeometry.hh>
+#include <dune/geometry/referenceelements.hh>
+#include <dune/localfefunctions/expressionCost.hh>
+
+/*
+ * Microbenchmark harness of the local functions. Each benchmark executable is a single translation unit, which includes
+ * this header and thus the allocation counting of test/allocationCounter.hh.
+ */
+namespace Dune::Benchmark {
+
+  /** \brief Prevents that the compiler optimizes away the computation of the value */
+  template <typename T>
+  void doNotOptimizeAway(const T& value) {
+    asm volatile("" : : "g"(&value) : "memory");
+  }
+
+  /** \brief The geometry of the reference element, embedded in the world, e.g. for UnitVector coefficients */
+  template <int worldDim, int gridDim>
+  auto referenceGeometry(const Dune::GeometryType& geometryType) {
+    const auto& refElement = Dune::ReferenceElements<double, gridDim>::general(geometryType);
+    std::vector<Dune::FieldVector<double, worldDim>> corners(refElement.size(gridDim));
+    for (std::size_t c = 0; c < corners.size(); ++c) {
+      corners[c] = 0.0;
+      for (int d = 0; d < gridDim; ++d)
+        corners[c][d] = refElement.position(c, gridDim)[d];
+    }
+    return std::make_shared<const Dune::MultiLinearGeometry<double, gridDim, worldDim>>(refElement, corners);
+  }
+
+  /** \brief The statistics of the wall time in nanoseconds, the heap allocations and the hardware counters of one
+   * call */
+  struct Measurement {
+    double median{};
+    double mean{};
+    double min{};
+    double standardDeviation{};
+    double allocations{};
+    HardwareCounters counters{};
+
+    /** \brief Normalizes the measurement, e.g. to one integration point */
+    Measurement& operator/=(double n) {
+      median /= n;
+      mean /= n;
+      min /= n;
+      standardDeviation /= n;
+      allocations /= n;
+      counters /= n;
+      return *this;
+    }
+
+    friend Measurement operator/(Measurement measurement, double n) { return measurement /= n; }
+  };
+
+  /** \brief Measures the calls of f. The first calls are not timed, since they e.g. fill the caches of the basis or
+   * create rebound clones. Short calls are batched, such that one sample takes at least minSampleTime. The hardware
+   * counters are read around the timed batches, if they are enabled, see PerfCounters. */
+  template <typename F>
+  Measurement measure(F&& f, int repetitions = 15, int warmUp = 2,
+                      std::chrono::nanoseconds minSampleTime = std::chrono::microseconds(20)) {
+    using Clock = std::chrono::steady_clock;
+    for (int i = 0; i < warmUp; ++i)
+      f();
+
+    int batch = 1;
+    for (;; batch *= 2) {
+      const auto start = Clock::now();
+      for (int i = 0; i < batch; ++i)
+        f();
+      if (Clock::now() - start >= minSampleTime or batch >= (1 << 20)) break;
+    }
+
+    auto& perfCounters = PerfCounters::instance();
+    std::vector<double> times(repetitions);
+    std::size_t allocations = 0;
+    std::optional<HardwareCounters> counters;
+    HardwareCounters counterSamples;
+    for (auto& time : times) {
+      if (perfCounters.enabled()) perfCounters.start();
+      allocations += AllocationCounter::countAllocations([&]() {
+        const auto start = Clock::now();
+        for (int i = 0; i < batch; ++i)
+          f();
+        time = std::chrono::duration<double, std::nano>(Clock::now() - start).count() / batch;
+      });
+      if (perfCounters.enabled()) {
+        const auto sample = perfCounters.stop();
+        counterSamples += sample.sampleCount();
+        if (counters)
+          *counters += sample;
+        else
+          counters = sample;
+      }
+    }
+
+    Measurement res;
+    if (counters) res.counters = (*counters /= counterSamples) /= batch;
+    res.mean        = std::accumulate(times.begin(), times.end(), 0.0) / repetitions;
+    res.min         = std::ranges::min(times);
+    res.allocations = static_cast<double>(allocations) / (static_cast<double>(repetitions) * batch);
+    for (double time : times)
+      res.standardDeviation += (time - res.mean) * (time - res.mean);
+    res.standardDeviation = std::sqrt(res.standardDeviation / std::max(repetitions - 1, 1));
+    std::ranges::nth_element(times, times.begin() + repetitions / 2);
+    res.median = times[repetitions / 2];
+    return res;
+  }
+
+  /** \brief One measurement, the parameters describe the setup, e.g. the grid dimension or the derivative order */
+  struct BenchmarkEntry {
+    std::string name;
+    std::vector<std::pair<std::string, std::string>> parameters;
+    /** \brief The measurement divided by the number of integration points */
+    Measurement perIntegrationPoint;
+    /** \brief A model of the bytes, which are read and written per integration point, if it is known */
+    std::optional<double> bytesPerIntegrationPoint{};
+    /** \brief The estimate of expressionCost() per integration point, if it is known */
+    std::optional<EvaluationCost> modelCostPerIntegrationPoint{};
+  };
+
+  /** \brief The peak performance in GFLOP/s and the memory bandwidth in GB/s of the machine, which are read from the
+   * environment variables DUNE_LOCALFEFUNCTIONS_PEAK_GFLOPS and DUNE_LOCALFEFUNCTIONS_PEAK_BANDWIDTH */
+  inline std::optional<std::pair<double, double>> machinePeak() {
+    const char* gflops    = std::getenv("DUNE_LOCALFEFUNCTIONS_PEAK_GFLOPS");
+    const char* bandwidth = std::getenv("DUNE_LOCALFEFUNCTIONS_PEAK_BANDWIDTH");
+    if (gflops == nullptr or bandwidth == nullptr) return std::nullopt;
+    return std::make_pair(std::atof(gflops), std::atof(bandwidth));
+  }
+
+  /** \brief The measurements of one benchmark executable. All entries are expected to have the same parameters. */
+  class BenchmarkResults {
+  public:
+    const std::vector<BenchmarkEntry>& entries() const { return entries_; }
+
+    void add(BenchmarkEntry entry) { entries_.push_back(std::move(entry)); }
+
+    void writeCSV(std::ostream& out) const {
+      if (entries_.empty()) return;
+      const auto header = fields(entries_.front());
+      for (bool first = true; const auto& [key, value] : header) {
+        out << (first ? "" : ",") << key;
+        first = false;
+      }
+      out << '\n';
+      for (const auto& entry : entries_) {
+        for (bool first = true; const auto& [key, value] : fields(entry)) {
+          out << (first ? "" : ",") << (isNumber(value) or value.empty() ? value : quoted(value, '"'));
+          first = false;
+        }
+        out << '\n';
+      }
+    }
+
+    void writeJSON(std::ostream& out) const {
+      out << "[";
+      for (bool firstEntry = true; const auto& entry : entries_) {
+        out << (firstEntry ? "\n  {" : ",\n  {");
+        for (bool first = true; const auto& [key, value] : fields(entry)) {
+          out << (first ? "" : ", ") << quoted(key, '\\') << ": "
+              << (value.empty() ? "null" : isNumber(value) ? value : quoted(value, '\\'));
+          first = false;
+        }
+        out << "}";
+        firstEntry = false;
+      }
+      out << "\n]\n";
+    }
+
+    /** \brief Writes JSON if the file name ends with .json and CSV otherwise */
+    void write(const std::string& fileName) const {
+      std::ofstream out(fileName);
+      if (fileName.ends_with(".json"))
+        writeJSON(out);
+      else
+        writeCSV(out);
+    }
+
+  private:
+    /* The columns of an entry, an unknown value is empty */
+    static std::vector<std::pair<std::string, std::string>> fields(const BenchmarkEntry& entry) {
+      auto toString = [](double value) {
+        std::ostringstream stream;
+        stream << value;
+        return stream.str();
+      };
+      const auto& m = entry.perIntegrationPoint;
+      std::vector<std::pair<std::string, std::string>> res{{"name", entry.name}};
+      res.insert(res.end(), entry.parameters.begin(), entry.parameters.end());
+      res.emplace_back("nsPerIntegrationPoint", toString(m.median));
+      res.emplace_back("meanNsPerIntegrationPoint", toString(m.mean));
+      res.emplace_back("minNsPerIntegrationPoint", toString(m.min));
+      res.emplace_back("standardDeviationNsPerIntegrationPoint", toString(m.standardDeviation));
+      res.emplace_back("allocationsPerIntegrationPoint", toString(m.allocations));
+      auto optionalToString = [&](const std::optional<double>& value) { return value ? toString(*value) : ""; };
+      const auto& bytes = entry.bytesPerIntegrationPoint;
+      const auto& c     = m.counters;
+      res.emplace_back("bytesPerIntegrationPoint", optionalToString(bytes));
+      res.emplace_back("cyclesPerIntegrationPoint", optionalToString(c.cycles));
+      res.emplace_back("instructionsPerIntegrationPoint", optionalToString(c.instructions));
+      res.emplace_back("ipc", optionalToString(c.ipc()));
+      res.emplace_back("l1dMissesPerIntegrationPoint", optionalToString(c.l1dMisses));
+      res.emplace_back("llcMissesPerIntegrationPoint", optionalToString(c.llcMisses));
+      res.emplace_back("flopsPerIntegrationPoint", optionalToString(c.flops));
+      res.emplace_back("flopsPerByte",
+                       optionalToString(c.flops and bytes and *bytes > 0 ? std::optional(*c.flops / *bytes)
+                                                                         : std::nullopt));
+
+      /* The achieved GFLOP/s of the modelled FLOPs and the fraction of the attainable GFLOP/s of the roofline */
+      const auto& model = entry.modelCostPerIntegrationPoint;
+      std::optional<double> gflops, rooflineFraction;
+      if (model and m.median > 0) gflops = model->flops / m.median;
+      if (const auto peak = machinePeak(); gflops and peak)
+        rooflineFraction = *gflops / attainableFlops(model->arithmeticIntensity(), peak->first, peak->second);
+      auto fromModel = [&](auto&& f) { return model ? toString(f(*model)) : ""; };
+      res.emplace_back("modelFlopsPerIntegrationPoint", fromModel([](const auto& cost) { return cost.flops; }));
+      res.emplace_back("modelBytesPerIntegrationPoint", fromModel([](const auto& cost) { return cost.bytes; }));
+      res.emplace_back("modelArithmeticIntensity",
+                       fromModel([](const auto& cost) { return cost.arithmeticIntensity(); }));
+      res.emplace_back("modelGflops", optionalToString(gflops));
+      res.emplace_back("rooflineFraction", optionalToString(rooflineFraction));
+      return res;
+    }
+
+    static bool isNumber(const std::string& str) {
+      double number;
+      const auto [ptr, error] = std::from_chars(str.data(), str.data() + str.size(), number);
+      return not str.empty() and error == std::errc() and ptr == str.data() + str.size();
+    }
+
+    /* Quotes the string, where quotes are escaped by doubling them (CSV) or by a backslash (JSON) */
+    static std::string quoted(const std::string& str, char escape) {
+      std::string res = "\"";
+      for (char c : str) {
+        if (c == '"' or (escape == '\\' and c == '\\')) res += escape;
+        res += c;
+      }
+      return res + '"';
+    }
+
+    std::vector<BenchmarkEntry> entries_;
+  };
+
+}  // namespace Dune::Benchmark
@@ -0,0 +1,253 @@
+// SPDX-FileCopyrightText: 2022 The dune-localfefunction developers mueller@ibb.uni-stuttgart.de
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/*
+ * Microbenchmarks of the core kernels on lines, quadrilaterals and hexahedra with Lagrange ansatz functions of order
+ * one and two: binding the cached basis, the sweep over the bound ansatz functions, the derivative transformation and
+ * the value and all derivatives of the leaf nodes and of some expressions.
+ *
+ * The derivatives w.r.t. the coefficients are requested for all coefficients or pairs of coefficients at each
+ * integration point, as in an assembly loop. The bytes are a model of the compulsory memory traffic, i.e. the bound
+ * ansatz functions and the coefficients are read once per integration point and each result is written once. The
+ * FLOPs and bytes of the local functions are additionally estimated by expressionCost(), which gives the achieved
+ * GFLOP/s and, with DUNE_LOCALFEFUNCTIONS_PEAK_GFLOPS and DUNE_LOCALFEFUNCTIONS_PEAK_BANDWIDTH, the fraction of the
+ * roofline. On hexahedra, the kernels of the expressions are additionally run with the structured derivatives w.r.t.
+ * the coefficients, i.e. scaled identity matrices, and with the equivalent dense matrices.
+ *
+ * Usage: benchmarkKernels [results.csv|results.json]
+ */
+
+#include <config.h>
+
+#include "../test/fecache.hh"
+#include "../test/testfactories.hh"
+#include "benchmarkHelper.hh"
+
+#include <iostream>
+
+#include <dune/common/parallel/mpihelper.hh>
+#include <dune/geometry/quadraturerules.hh>
+#include <dune/localfefunctions/cachedlocalBasis/cachedlocalBasis.hh>
+#include <dune/localfefunctions/derivativetransformators.hh>
+#include <dune/localfefunctions/expressions.hh>
+#include <dune/localfefunctions/impl/projectionBasedLocalFunction.hh>
+#include <dune/localfefunctions/impl/standardLocalFunction.hh>
+#include <dune/localfefunctions/manifolds/realTuple.hh>
+#include <dune/localfefunctions/manifolds/unitVector.hh>
+
+using Dune::Benchmark::BenchmarkResults;
+using Dune::Benchmark::referenceGeometry;
+using Parameters = std::vector<std::pair<std::string, std::string>>;
+
+/* Benchmarks the value and all derivatives of the local function */
+template <typename LF>
+void benchmarkLocalFunction(const std::string& name, const LF& lf, const Parameters& parameters,
+                            std::size_t basisBytes, BenchmarkResults& results) {
+  using namespace Dune;
+  using namespace Dune::DerivativeDirections;
+  using Benchmark::doNotOptimizeAway;
+  const auto& coeffs                   = lf.node().coefficientsRef();
+  const std::size_t coeffSize          = coeffs.size();
+  using Manifold                       = typename std::remove_cvref_t<decltype(coeffs)>::value_type;
+  constexpr int gridDim                = LF::gridDim;
+  constexpr int localFunctionValueSize = LF::Traits::valueSize;
+  const auto alongVec                  = createOnesVector<double, localFunctionValueSize>();
+  const auto alongMat                  = createOnesMatrix<double, localFunctionValueSize, gridDim>();
+  const std::size_t inputBytes         = basisBytes + coeffSize * Manifold::valueSize * sizeof(double);
+
+  int integrationPoints = 0;
+  for ([[maybe_unused]] const auto& [ipIndex, ip] : lf.viewOverIntegrationPoints())
+    ++integrationPoints;
+
+  /* The evaluation is called for all coefficients, if coefficientLoops is one, and for all pairs, if it is two */
+  auto add = [&](const std::string& signature, auto coefficientLoops, bool spatialAll, auto&& evaluate) {
+    using Result            = std::remove_cvref_t<decltype(evaluate(0UL, 0UL, 0UL))>;
+    const std::size_t calls = coefficientLoops == 0 ? 1 : coefficientLoops == 1 ? coeffSize : coeffSize * coeffSize;
+    auto sweep              = [&]() {
+      for (const auto& [ipIndex, ip] : lf.viewOverIntegrationPoints())
+        if constexpr (coefficientLoops == 0)
+          doNotOptimizeAway(evaluate(ipIndex, 0UL, 0UL));
+        else
+          for (std::size_t i = 0; i < coeffSize; ++i)
+            if constexpr (coefficientLoops == 1)
+              doNotOptimizeAway(evaluate(ipIndex, i, 0UL));
+            else
+              for (std::size_t j = 0; j < coeffSize; ++j)
+                doNotOptimizeAway(evaluate(ipIndex, i, j));
+    };
+    auto entryParameters = parameters;
+    entryParameters.emplace_back("signature", signature);
+    const CostSignature costSignature{static_cast<int>(coefficientLoops), spatialAll};
+    const auto cost = expressionCost<LF>(costSignature, static_cast<int>(coeffSize)).total();
+    results.add({name, std::move(entryParameters), Benchmark::measure(sweep) / integrationPoints,
+                 static_cast<double>(inputBytes + calls * sizeof(Result)), static_cast<double>(calls) * cost});
+  };
+
+  using Dune::Indices::_0, Dune::Indices::_1, Dune::Indices::_2;
+  add("value", _0, false, [&](auto ipIndex, auto, auto) { return lf.evaluate(ipIndex, on(gridElement)); });
+  add("d/(dspatialAll)", _0, true,
+      [&](auto ipIndex, auto, auto) { return lf.evaluateDerivative(ipIndex, wrt(spatialAll), on(gridElement)); });
+  add("d/(dcoeff)", _1, false,
+      [&](auto ipIndex, auto i, auto) { return lf.evaluateDerivative(ipIndex, wrt(coeff(i)), on(gridElement)); });
+  add("d2/(dspatialAll dcoeff)", _1, true, [&](auto ipIndex, auto i, auto) {
+    return lf.evaluateDerivative(ipIndex, wrt(spatialAll, coeff(i)), on(gridElement));
+  });
+  add("d2/(dcoeff dcoeff) along", _2, false, [&](auto ipIndex, auto i, auto j) {
+    return lf.evaluateDerivative(ipIndex, wrt(coeff(i, j)), along(alongVec), on(gridElement));
+  });
+  add("d3/(dspatialAll dcoeff dcoeff) along", _2, true, [&](auto ipIndex, auto i, auto j) {
+    return lf.evaluateDerivative(ipIndex, wrt(coeff(i, j), spatialAll), along(alongMat), on(gridElement));
+  });
+}
+
+template <int gridDim, int lagrangeOrder>
+void benchmarkKernelsOnCube(BenchmarkResults& results) {
+  using namespace Dune;
+  using Benchmark::doNotOptimizeAway;
+  const auto geometryType = GeometryTypes::cube(gridDim);
+  FECache<gridDim, lagrangeOrder> feCache;
+  const auto& fe         = feCache.get(geometryType);
+  const auto& rule       = QuadratureRules<double, gridDim>::rule(geometryType, 2 * lagrangeOrder);
+  const int nIPs         = rule.size();
+  const std::size_t n    = fe.size();
+  const auto basisBytes  = n * (1 + gridDim) * sizeof(double);
+  const Parameters setup = {{"gridDim", std::to_string(gridDim)},
+                            {"lagrangeOrder", std::to_string(lagrangeOrder)},
+                            {"ansatzFunctions", std::to_string(n)}};
+  auto withSignature     = [&](const std::string& signature) {
+    auto res = setup;
+    res.emplace_back("signature", signature);
+    return res;
+  };
+
+  auto localBasis = CachedLocalBasis(fe.localBasis());
+  results.add({"CachedLocalBasis::bind", withSignature("bindDerivatives(0, 1)"),
+               Benchmark::measure([&]() { localBasis.bind(rule, bindDerivatives(0, 1)); }) / nIPs,
+               static_cast<double>(basisBytes)});
+
+  results.add({"CachedLocalBasis::viewOverFunctionAndJacobian", withSignature("N and dN"),
+               Benchmark::measure([&]() {
+                 double sum = 0.0;
+                 for (const auto& [index, ip, N, dN] : localBasis.viewOverFunctionAndJacobian())
+                   for (std::size_t k = 0; k < n; ++k) {
+                     sum += N[k];
+                     for (int d = 0; d < gridDim; ++d)
+                       sum += coeff(dN, k, d);
+                   }
+                 doNotOptimizeAway(sum);
+               }) / nIPs,
+               static_cast<double>(basisBytes)});
+
+  const auto geometry = referenceGeometry<gridDim, gridDim>(geometryType);
+  auto transformed    = makeTransformedDerivativesCache(localBasis);
+  results.add({"DefaultFirstOrderTransformFunctor", withSignature("dN"),
+               Benchmark::measure([&]() {
+                 for (const auto& [index, ip] : localBasis.viewOverIntegrationPoints()) {
+                   DefaultFirstOrderTransformFunctor()(*geometry, ip.position(), localBasis.evaluateJacobian(index),
+                                                       transformed->derivatives());
+                   doNotOptimizeAway(transformed->derivatives());
+                 }
+               }) / nIPs,
+               static_cast<double>(2 * n * gridDim * sizeof(double))});
+
+  Dune::BlockVector<RealTuple<double, gridDim>> displacements;
+  ValueFactory<RealTuple<double, gridDim>>::construct(displacements, n);
+  auto u = StandardLocalFunction(localBasis, displacements, geometry);
+  benchmarkLocalFunction("StandardLocalFunction", u, setup, basisBytes, results);
+  benchmarkLocalFunction("NormSquared", normSquared(u), setup, basisBytes, results);
+  benchmarkLocalFunction("Dot", dot(u, 2.0 * u), setup, basisBytes, results);
+  benchmarkLocalFunction("Sqrt", sqrt(normSquared(u)), setup, basisBytes, results);
+  if constexpr (gridDim > 1) {
+    benchmarkLocalFunction("LinearStrains", linearStrains(u), setup, basisBytes, results);
+    benchmarkLocalFunction("GreenLagrangeStrains", greenLagrangeStrains(u), setup, basisBytes, results);
+
+    Dune::BlockVector<UnitVector<double, 3>> directors;
+    ValueFactory<UnitVector<double, 3>>::construct(directors, n);
+    auto t = ProjectionBasedLocalFunction(localBasis, directors, referenceGeometry<3, gridDim>(geometryType));
+    benchmarkLocalFunction("ProjectionBasedLocalFunction", t, setup, basisBytes, results);
+  }
+}
+
+/* The kernels, which the expressions apply to the derivatives w.r.t. the coefficients of a vector valued leaf node,
+ * once with the structured derivatives and once with dense matrices. The derivatives are created from the bound
+ * ansatz functions as by StandardLocalFunction, such that the creation of the dense matrices is included. */
+template <int gridDim, int lagrangeOrder>
+void benchmarkStructuredDerivatives(BenchmarkResults& results) {
+  using namespace Dune;
+  using Benchmark::doNotOptimizeAway;
+  constexpr int valueSize = gridDim;
+  const auto geometryType = GeometryTypes::cube(gridDim);
+  FECache<gridDim, lagrangeOrder> feCache;
+  const auto& fe   = feCache.get(geometryType);
+  const auto& rule = QuadratureRules<double, gridDim>::rule(geometryType, 2 * lagrangeOrder);
+  auto localBasis  = CachedLocalBasis(fe.localBasis());
+  localBasis.bind(rule, bindDerivatives(0, 1));
+  const int nIPs      = rule.size();
+  const std::size_t n = fe.size();
+  const auto u        = createOnesVector<double, valueSize>();
+
+  auto structured = [](double value) { return createScaledIdentityMatrix<double, valueSize, valueSize>(value); };
+  auto dense      = [](double value) {
+    auto res = createZeroMatrix<double, valueSize, valueSize>();
+    for (int d = 0; d < valueSize; ++d)
+      coeff(res, d, d) = value;
+    return res;
+  };
+
+  auto add = [&](const std::string& name, const std::string& kernel, auto&& sweep) {
+    const Parameters parameters = {{"gridDim", std::to_string(gridDim)},
+                                   {"lagrangeOrder", std::to_string(lagrangeOrder)},
+                                   {"ansatzFunctions", std::to_string(n)},
+                                   {"signature", kernel}};
+    results.add({name, parameters, Benchmark::measure(sweep) / nIPs});
+  };
+
+  auto addKernels = [&](const std::string& name, auto&& derivative) {
+    add(name, "leftMultiplyTranspose(u, df/dcoeff)", [&]() {
+      for (const auto& [index, ip] : localBasis.viewOverIntegrationPoints()) {
+        const auto& N = localBasis.evaluateFunction(index);
+        for (std::size_t i = 0; i < n; ++i)
+          doNotOptimizeAway(eval(leftMultiplyTranspose(u, derivative(N[i]))));
+      }
+    });
+    add(name, "df/dcoeff + 2 df/dcoeff", [&]() {
+      for (const auto& [index, ip] : localBasis.viewOverIntegrationPoints()) {
+        const auto& N = localBasis.evaluateFunction(index);
+        for (std::size_t i = 0; i < n; ++i) {
+          const auto dfdi = derivative(N[i]);
+          auto scaled     = dfdi;
+          scaled *= 2.0;
+          doNotOptimizeAway(eval(dfdi + scaled));
+        }
+      }
+    });
+    add(name, "leftMultiplyTranspose(df/dcoeff, df/dcoeff)", [&]() {
+      for (const auto& [index, ip] : localBasis.viewOverIntegrationPoints()) {
+        const auto& N = localBasis.evaluateFunction(index);
+        for (std::size_t i = 0; i < n; ++i)
+          for (std::size_t j = 0; j < n; ++j)
+            doNotOptimizeAway(eval(leftMultiplyTranspose(derivative(N[i]), derivative(N[j]))));
+      }
+    });
+  };
+  addKernels("ScaledIdentityDerivatives", structured);
+  addKernels("DenseDerivatives", dense);
+}
+
+int main(int argc, char** argv) {
+  Dune::MPIHelper::instance(argc, argv);
+  BenchmarkResults results;
+
+  benchmarkKernelsOnCube<1, 1>(results);
+  benchmarkKernelsOnCube<1, 2>(results);
+  benchmarkKernelsOnCube<2, 1>(results);
+  benchmarkKernelsOnCube<2, 2>(results);
+  benchmarkKernelsOnCube<3, 1>(results);
+  benchmarkKernelsOnCube<3, 2>(results);
+  benchmarkStructuredDerivatives<3, 1>(results);
+  benchmarkStructuredDerivatives<3, 2>(results);
+
+  results.writeCSV(std::cout);
+  if (argc > 1) results.write(argv[1]);
+  return 0;
+}
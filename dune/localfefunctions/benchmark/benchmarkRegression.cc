@@ -0,0 +1,243 @@
+// SPDX-FileCopyrightText: 2022 The dune-localfefunction developers mueller@ibb.uni-stuttgart.de
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/*
+ * Performance regression test of the key kernels against the committed baseline regressionBaseline.csv.
+ *
+ * The timings are divided by the timing of a fixed calibration loop of small dense matrix operations, such that the
+ * baseline is roughly independent of the clock rate of the machine. The calibration loop is measured before, between
+ * and after the kernels and its spread together with the spread of the kernel gives the tolerance band of each kernel.
+ * A kernel fails if its normalized time exceeds the baseline by more than the tolerance. A noisy kernel is measured
+ * again and if the machine is still too noisy to detect a slowdown of maxTolerance, the test is skipped. A missing or
+ * empty baseline and kernels without a baseline fail the test, such that the comparison cannot be silently disabled.
+ *
+ * Usage: benchmarkRegression <baseline.csv>                   compare with the baseline
+ *        benchmarkRegression --write-baseline <baseline.csv>  overwrite the baseline with the current timings
+ *
+ * The target benchmarkRegressionBaseline writes the baseline into the build directory. It never overwrites the
+ * committed baseline, thus a new baseline has to be copied into dune/localfefunctions/benchmark by hand.
+ */
+
+#include <config.h>
+
+#include "../test/fecache.hh"
+#include "../test/testfactories.hh"
+#include "benchmarkHelper.hh"
+
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+
+#include <dune/common/exceptions.hh>
+#include <dune/common/parallel/mpihelper.hh>
+#include <dune/geometry/quadraturerules.hh>
+#include <dune/localfefunctions/cachedlocalBasis/cachedlocalBasis.hh>
+#include <dune/localfefunctions/expressions.hh>
+#include <dune/localfefunctions/impl/standardLocalFunction.hh>
+#include <dune/localfefunctions/manifolds/realTuple.hh>
+
+#include <Eigen/Dense>
+
+using namespace Dune::Benchmark;
+
+/* A slowdown below baseTolerance is never reported, a machine which cannot resolve maxTolerance skips the test */
+constexpr double baseTolerance = 0.1;
+constexpr double maxTolerance  = 0.2;
+constexpr int maxAttempts      = 3;
+constexpr int skipReturnCode   = 77;
+
+/* The fixed workload to which all timings are normalized */
+void calibrationLoop() {
+  Eigen::Matrix3d A = Eigen::Matrix3d::Identity() + 0.1 * Eigen::Matrix3d::Ones();
+  Eigen::Matrix3d B = Eigen::Matrix3d::Identity();
+  for (int i = 0; i < 256; ++i) {
+    B = (A * B).eval();
+    B = (B.inverse().transpose() + B) * 0.5;
+    doNotOptimizeAway(B);
+  }
+}
+
+struct Calibration {
+  std::vector<double> samples;
+
+  void sample() { samples.push_back(measure(calibrationLoop).median); }
+
+  double median() const {
+    auto sorted = samples;
+    std::ranges::sort(sorted);
+    return sorted[sorted.size() / 2];
+  }
+
+  /* The relative spread of the calibration samples, which is the drift of the machine during the run */
+  double noise() const { return (std::ranges::max(samples) - std::ranges::min(samples)) / median(); }
+};
+
+/* The relative spread of a measurement, above which the tolerance band would exceed maxTolerance */
+constexpr double maxSpread = (maxTolerance - baseTolerance) / 2.0;
+
+using Timings = std::vector<std::pair<std::string, Measurement>>;
+
+/* Measures the spatial gradient of the displacements and the residual and stiffness matrix of a hyperelastic element.
+ * A noisy kernel is measured again with more repetitions. */
+template <int gridDim, int lagrangeOrder>
+void measureKernels(Timings& timings, Calibration& calibration) {
+  using namespace Dune;
+  using namespace Dune::DerivativeDirections;
+  const auto geometryType = GeometryTypes::cube(gridDim);
+  FECache<gridDim, lagrangeOrder> feCache;
+  const auto& fe   = feCache.get(geometryType);
+  const auto& rule = QuadratureRules<double, gridDim>::rule(geometryType, 2 * lagrangeOrder);
+  auto localBasis  = CachedLocalBasis(fe.localBasis());
+  localBasis.bind(rule, bindDerivatives(0, 1));
+  Dune::BlockVector<RealTuple<double, gridDim>> displacements;
+  ValueFactory<RealTuple<double, gridDim>>::construct(displacements, fe.size());
+  const std::size_t coeffSize = displacements.size();
+  const std::string setup
+      = "gridDim=" + std::to_string(gridDim) + " lagrangeOrder=" + std::to_string(lagrangeOrder) + " ";
+
+  auto add = [&](const std::string& key, auto&& sweep) {
+    auto measurement = measure(sweep);
+    for (int attempt = 1; measurement.standardDeviation / measurement.median > maxSpread and attempt < maxAttempts;
+         ++attempt)
+      measurement = measure(sweep, 31);
+    timings.emplace_back(key, measurement);
+    calibration.sample();
+  };
+
+  auto u = StandardLocalFunction(localBasis, displacements, referenceGeometry<gridDim, gridDim>(geometryType));
+  add("StandardLocalFunction " + setup + "d/(dspatialAll)", [&]() {
+    for (const auto& [ipIndex, ip] : u.viewOverIntegrationPoints())
+      doNotOptimizeAway(u.evaluateDerivative(ipIndex, wrt(spatialAll), on(gridElement)));
+  });
+  add("StandardLocalFunction " + setup + "d2/(dspatialAll dcoeff)", [&]() {
+    for (const auto& [ipIndex, ip] : u.viewOverIntegrationPoints())
+      for (std::size_t i = 0; i < coeffSize; ++i)
+        doNotOptimizeAway(u.evaluateDerivative(ipIndex, wrt(spatialAll, coeff(i)), on(gridElement)));
+  });
+
+  if constexpr (gridDim > 1) {
+    auto eps            = greenLagrangeStrains(u);
+    const auto stresses = createOnesVector<double, decltype(eps)::valueSize>();
+    add("GreenLagrangeStrains " + setup + "d/(dcoeff)", [&]() {
+      for (const auto& [ipIndex, ip] : eps.viewOverIntegrationPoints())
+        for (std::size_t i = 0; i < coeffSize; ++i)
+          doNotOptimizeAway(eps.evaluateDerivative(ipIndex, wrt(coeff(i)), on(gridElement)));
+    });
+    add("GreenLagrangeStrains " + setup + "d2/(dcoeff dcoeff) along", [&]() {
+      for (const auto& [ipIndex, ip] : eps.viewOverIntegrationPoints())
+        for (std::size_t i = 0; i < coeffSize; ++i)
+          for (std::size_t j = 0; j < coeffSize; ++j)
+            doNotOptimizeAway(eps.evaluateDerivative(ipIndex, wrt(coeff(i, j)), along(stresses), on(gridElement)));
+    });
+
+    auto linearEps = linearStrains(u);
+    add("LinearStrains " + setup + "d/(dcoeff)", [&]() {
+      for (const auto& [ipIndex, ip] : linearEps.viewOverIntegrationPoints())
+        for (std::size_t i = 0; i < coeffSize; ++i)
+          doNotOptimizeAway(linearEps.evaluateDerivative(ipIndex, wrt(coeff(i)), on(gridElement)));
+    });
+  }
+}
+
+/* Reads the lines key,normalizedTime, lines starting with # are comments */
+std::map<std::string, double> readBaseline(const std::string& fileName) {
+  std::ifstream in(fileName);
+  if (not in) DUNE_THROW(Dune::IOError, "Could not open the baseline " + fileName);
+  std::map<std::string, double> res;
+  for (std::string line; std::getline(in, line);) {
+    if (line.empty() or line.starts_with('#') or line.starts_with("kernel,")) continue;
+    const auto comma = line.rfind(',');
+    if (comma == std::string::npos or comma + 1 == line.size()) continue;
+    res[line.substr(0, comma)] = std::stod(line.substr(comma + 1));
+  }
+  return res;
+}
+
+int main(int argc, char** argv) {
+  Dune::MPIHelper::instance(argc, argv);
+  const bool writeBaseline = argc == 3 and std::string(argv[1]) == "--write-baseline";
+  if (argc != 2 and not writeBaseline) {
+    std::cerr << "Usage: " << argv[0] << " [--write-baseline] <baseline.csv>" << std::endl;
+    return 1;
+  }
+  const std::string baselineFile = argv[argc - 1];
+
+  Calibration calibration;
+  calibration.sample();
+  Timings timings;
+  measureKernels<2, 1>(timings, calibration);
+  measureKernels<2, 2>(timings, calibration);
+  measureKernels<3, 1>(timings, calibration);
+  measureKernels<3, 2>(timings, calibration);
+
+  if (writeBaseline) {
+    std::ofstream out(baselineFile);
+    out << "# Normalized timings of benchmarkRegression, regenerate with the target benchmarkRegressionBaseline and\n"
+        << "# copy the file from the build directory to dune/localfefunctions/benchmark/regressionBaseline.csv\n";
+    out << "kernel,normalizedTime\n";
+    for (const auto& [key, measurement] : timings)
+      out << key << ',' << std::setprecision(6) << measurement.median / calibration.median() << '\n';
+    std::cout << "Wrote the baseline of " << timings.size() << " kernels to " << baselineFile << std::endl;
+    return 0;
+  }
+
+  std::map<std::string, double> baseline;
+  try {
+    baseline = readBaseline(baselineFile);
+  } catch (const Dune::IOError& e) {
+    std::cerr << e.what() << std::endl;
+    return 1;
+  }
+  if (baseline.empty()) {
+    std::cerr << "ERROR: The baseline " << baselineFile << " contains no timings, thus no kernel can be compared.\n"
+              << "Generate it with the target benchmarkRegressionBaseline on the reference machine, copy it from the "
+              << "build directory into the source tree and commit it."
+              << std::endl;
+    return 1;
+  }
+
+  int failed = 0, compared = 0, noisy = 0, missing = 0;
+  std::cout << std::left << std::setw(72) << "kernel" << std::right << std::setw(10) << "ratio" << std::setw(12)
+            << "tolerance" << std::endl;
+  for (const auto& [key, measurement] : timings) {
+    const auto it = baseline.find(key);
+    if (it == baseline.end()) {
+      std::cout << std::left << std::setw(72) << key << "  MISSING BASELINE" << std::endl;
+      ++missing;
+      continue;
+    }
+
+    const double spread    = std::max(calibration.noise(), measurement.standardDeviation / measurement.median);
+    const double ratio     = measurement.median / calibration.median() / it->second;
+    const double tolerance = baseTolerance + 2.0 * spread;
+    const bool tooNoisy    = tolerance >= maxTolerance;
+    const bool slower      = ratio > 1.0 + tolerance;
+    std::cout << std::left << std::setw(72) << key << std::right << std::fixed << std::setprecision(3) << std::setw(10)
+              << ratio << std::setw(12) << tolerance
+              << (slower ? "  REGRESSION" : tooNoisy ? "  too noisy" : ratio < 1.0 - tolerance ? "  faster" : "")
+              << std::endl;
+    ++compared;
+    if (slower)
+      ++failed;
+    else if (tooNoisy)
+      ++noisy;
+  }
+
+  if (failed > 0 or missing > 0) {
+    if (failed > 0)
+      std::cout << failed << " of " << compared << " kernels are slower than the baseline " << baselineFile
+                << ". If this is expected, regenerate it with the target benchmarkRegressionBaseline and copy it "
+                << "into the source tree." << std::endl;
+    if (missing > 0)
+      std::cout << missing << " kernels have no entry in the baseline " << baselineFile
+                << ", regenerate it with the target benchmarkRegressionBaseline and copy it into the source tree."
+                << std::endl;
+    return 1;
+  }
+  if (noisy > 0) {
+    std::cout << "The machine is too noisy to detect regressions reliably." << std::endl;
+    return skipReturnCode;
+  }
+  return 0;
+}
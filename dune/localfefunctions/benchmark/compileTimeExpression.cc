@@ -0,0 +1,110 @@
+// SPDX-FileCopyrightText: 2022 The dune-localfefunction developers mueller@ibb.uni-stuttgart.de
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/*
+ * One entry of the compile time matrix, which is compiled but never linked. The expression kind, its nesting depth and
+ * the derivative order are selected by COMPILE_TIME_KIND, COMPILE_TIME_DEPTH and COMPILE_TIME_DERIVATIVE_ORDER, see
+ * the CMakeLists.txt. Each entry instantiates the evaluation of one expression with one derivative order, such that
+ * the instantiations of LocalFunctionEvaluationArgs, Wrt, Along and On and of the evaluate*Impl dispatch are attributed
+ * to a single expression.
+ *
+ * The kinds nest as follows, where u is a StandardLocalFunction of the displacements on a quadrilateral:
+ *   Leaf:    u
+ *   Dot:     dot(u + ... + u, u) with depth summands
+ *   Sqrt:    sqrt(...sqrt(dot(u, u))...) with depth square roots
+ *   Strains: dot(E + ... + E, E) with depth summands of the Green-Lagrange strains E of u
+ */
+
+#include <config.h>
+
+#include "../test/fecache.hh"
+#include "benchmarkHelper.hh"
+
+#include <dune/geometry/quadraturerules.hh>
+#include <dune/istl/bvector.hh>
+#include <dune/localfefunctions/cachedlocalBasis/cachedlocalBasis.hh>
+#include <dune/localfefunctions/expressions.hh>
+#include <dune/localfefunctions/impl/standardLocalFunction.hh>
+#include <dune/localfefunctions/manifolds/realTuple.hh>
+
+namespace {
+  enum class Kind { Leaf, Dot, Sqrt, Strains };
+
+  constexpr Kind kind           = Kind::COMPILE_TIME_KIND;
+  constexpr int depth           = COMPILE_TIME_DEPTH;
+  constexpr int derivativeOrder = COMPILE_TIME_DERIVATIVE_ORDER;
+  constexpr int gridDim         = 2;
+
+  template <int n, typename LF, typename Term>
+  auto repeatedSum(const LF& u, Term&& term) {
+    if constexpr (n == 1)
+      return term(u);
+    else
+      return repeatedSum<n - 1>(u, term) + term(u);
+  }
+
+  template <int n, typename LF>
+  auto nestedSqrt(const LF& u) {
+    if constexpr (n == 1)
+      return sqrt(dot(u, u));
+    else
+      return sqrt(nestedSqrt<n - 1>(u));
+  }
+
+  template <typename LF>
+  auto expression(const LF& u) {
+    if constexpr (kind == Kind::Leaf)
+      return u;
+    else if constexpr (kind == Kind::Dot)
+      return dot(repeatedSum<depth>(u, [](const auto& v) { return v; }), u);
+    else if constexpr (kind == Kind::Sqrt)
+      return nestedSqrt<depth>(u);
+    else
+      return dot(repeatedSum<depth>(u, [](const auto& v) { return Dune::greenLagrangeStrains(v); }),
+                 Dune::greenLagrangeStrains(u));
+  }
+
+  /* The evaluations of the given derivative order, as they are requested by an assembler of the residual (1), the
+   * stiffness matrix (2) or a stiffness matrix with spatial derivatives (3) */
+  template <typename LF>
+  void evaluate(const LF& f, std::size_t coeffSize) {
+    using namespace Dune::DerivativeDirections;
+    using Dune::Benchmark::doNotOptimizeAway;
+    constexpr int valueSize = LF::Traits::valueSize;
+    const auto alongVec     = Dune::createOnesVector<double, valueSize>();
+    const auto alongMat     = Dune::createOnesMatrix<double, valueSize, gridDim>();
+    for (const auto& [ipIndex, ip] : f.viewOverIntegrationPoints()) {
+      if constexpr (derivativeOrder == 0) {
+        doNotOptimizeAway(f.evaluate(ipIndex, Dune::on(gridElement)));
+        doNotOptimizeAway(f.evaluateDerivative(ipIndex, Dune::wrt(spatialAll), Dune::on(gridElement)));
+      } else
+        for (std::size_t i = 0; i < coeffSize; ++i) {
+          if constexpr (derivativeOrder == 1)
+            doNotOptimizeAway(f.evaluateDerivative(ipIndex, Dune::wrt(coeff(i)), Dune::on(gridElement)));
+          else
+            for (std::size_t j = 0; j < coeffSize; ++j)
+              if constexpr (derivativeOrder == 2)
+                doNotOptimizeAway(f.evaluateDerivative(ipIndex, Dune::wrt(coeff(i, j)), Dune::along(alongVec),
+                                                       Dune::on(gridElement)));
+              else
+                doNotOptimizeAway(f.evaluateDerivative(ipIndex, Dune::wrt(coeff(i, j), spatialAll),
+                                                       Dune::along(alongMat), Dune::on(gridElement)));
+        }
+    }
+  }
+}  // namespace
+
+/* The entry point with external linkage, such that the evaluations are not discarded */
+void compileTimeExpression() {
+  using namespace Dune;
+  const auto geometryType = GeometryTypes::cube(gridDim);
+  FECache<gridDim, 1> feCache;
+  const auto& fe = feCache.get(geometryType);
+
+  auto localBasis = CachedLocalBasis(fe.localBasis());
+  localBasis.bind(QuadratureRules<double, gridDim>::rule(geometryType, 2), bindDerivatives(0, 1));
+  BlockVector<RealTuple<double, gridDim>> displacements(fe.size());
+  const auto geometry = Benchmark::referenceGeometry<gridDim, gridDim>(geometryType);
+  auto u              = StandardLocalFunction(localBasis, displacements, geometry);
+  evaluate(expression(u), displacements.size());
+}
@@ -0,0 +1,100 @@
+# SPDX-FileCopyrightText: 2022 The dune-localfefunction developers
+# mueller@ibb.uni-stuttgart.de SPDX-License-Identifier: LGPL-2.1-or-later
+
+# Aggregates the -ftime-trace files and the object sizes of the compile time
+# matrix, see the target compileTimeReport.
+#
+# Usage: cmake -DMANIFEST=<manifest> -DOUTPUT=<csv> [-DBUDGET=<ms>] -P
+# compileTimeReport.cmake
+#
+# Each line of the manifest is kind,depth,derivativeOrder,object. The trace of
+# an object x.cc.o is x.cc.json, which Clang writes next to it. The times are
+# the totals of the trace in milliseconds. If BUDGET is larger than zero, the
+# report fails if the compilation of an entry takes longer.
+
+# Sets <prefix>Ms and <prefix>Count to the total duration and count of an event
+function(trace_total trace event prefix)
+  set(duration 0)
+  set(count 0)
+  string(FIND "${trace}" "\"name\":\"Total ${event}\"" position)
+  if(NOT position EQUAL -1)
+    # The event object is {"pid":..,"dur":..,"name":..,"args":{"count":..}}
+    set(begin 0)
+    if(position GREATER 200)
+      math(EXPR begin "${position} - 200")
+    endif()
+    string(SUBSTRING "${trace}" ${begin} 400 window)
+    math(EXPR position "${position} - ${begin}")
+    string(SUBSTRING "${window}" 0 ${position} head)
+    string(FIND "${head}" "{" objectBegin REVERSE)
+    string(SUBSTRING "${window}" ${objectBegin} -1 object)
+    string(REGEX MATCH "^[^}]*\"dur\":([0-9]+)" match "${object}")
+    if(match)
+      math(EXPR duration "${CMAKE_MATCH_1} / 1000")
+    endif()
+    string(REGEX MATCH "\"args\":{\"count\":([0-9]+)" match "${object}")
+    if(match)
+      set(count ${CMAKE_MATCH_1})
+    endif()
+  endif()
+  set(${prefix}Ms
+      ${duration}
+      PARENT_SCOPE)
+  set(${prefix}Count
+      ${count}
+      PARENT_SCOPE)
+endfunction()
+
+if(NOT DEFINED BUDGET)
+  set(BUDGET 0)
+endif()
+
+file(STRINGS "${MANIFEST}" entries)
+set(csv
+    "kind,depth,derivativeOrder,compileMs,frontendMs,backendMs,instantiateClassMs,instantiateClasses,instantiateFunctionMs,instantiateFunctions,objectBytes\n"
+)
+set(overBudget "")
+foreach(entry ${entries})
+  string(REPLACE "," ";" fields "${entry}")
+  list(GET fields 0 kind)
+  list(GET fields 1 depth)
+  list(GET fields 2 order)
+  list(GET fields 3 object)
+  if(NOT EXISTS "${object}")
+    message(FATAL_ERROR "The object ${object} of ${kind} does not exist")
+  endif()
+  file(SIZE "${object}" objectBytes)
+
+  string(REGEX REPLACE "\\.o(bj)?$" ".json" traceFile "${object}")
+  if(EXISTS "${traceFile}")
+    file(READ "${traceFile}" trace)
+    trace_total("${trace}" ExecuteCompiler compile)
+    trace_total("${trace}" Frontend frontend)
+    trace_total("${trace}" Backend backend)
+    trace_total("${trace}" InstantiateClass instantiateClass)
+    trace_total("${trace}" InstantiateFunction instantiateFunction)
+    string(
+      APPEND
+      csv
+      "${kind},${depth},${order},${compileMs},${frontendMs},${backendMs},"
+      "${instantiateClassMs},${instantiateClassCount},"
+      "${instantiateFunctionMs},${instantiateFunctionCount},${objectBytes}\n")
+    if(BUDGET GREATER 0 AND compileMs GREATER BUDGET)
+      list(APPEND overBudget
+           "${kind} depth ${depth} derivative order ${order}: ${compileMs} ms")
+    endif()
+  else()
+    string(APPEND csv "${kind},${depth},${order},,,,,,,,${objectBytes}\n")
+  endif()
+endforeach()
+
+file(WRITE "${OUTPUT}" "${csv}")
+message("${csv}")
+message(STATUS "Wrote the compile time report to ${OUTPUT}")
+
+if(overBudget)
+  list(JOIN overBudget "\n  " overBudget)
+  message(
+    FATAL_ERROR
+      "The compilation exceeds the budget of ${BUDGET} ms for\n  ${overBudget}")
+endif()
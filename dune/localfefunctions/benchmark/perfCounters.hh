@@ -0,0 +1,236 @@
+// SPDX-FileCopyrightText: 2022 The dune-localfefunction developers mueller@ibb.uni-stuttgart.de
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#pragma once
+
+#include <cerrno>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#if defined(__linux__) && __has_include(<linux/perf_event.h>)
+#  define DUNE_LOCALFEFUNCTIONS_HAVE_PERF_EVENT 1
+#  include <linux/perf_event.h>
+#  include <sys/ioctl.h>
+#  include <sys/syscall.h>
+#  include <unistd.h>
+#endif
+
+namespace Dune::Benchmark {
+
+  /** \brief Hardware counter values, a value is empty if the counter is not available on this machine */
+  struct HardwareCounters {
+    std::optional<double> cycles;
+    std::optional<double> instructions;
+    std::optional<double> l1dMisses;
+    std::optional<double> llcMisses;
+    std::optional<double> flops;
+
+    /** \brief Adds the counters of the same name, a counter which is only read in one of both is taken from it */
+    HardwareCounters& operator+=(const HardwareCounters& other) {
+      forEach(other, [](auto& value, const auto& otherValue) {
+        if (otherValue) value = value.value_or(0.0) + *otherValue;
+      });
+      return *this;
+    }
+
+    HardwareCounters& operator/=(double n) {
+      forEach(*this, [n](auto& value, const auto&) {
+        if (value) *value /= n;
+      });
+      return *this;
+    }
+
+    /** \brief Divides each counter by the counter of the same name, e.g. by its number of samples */
+    HardwareCounters& operator/=(const HardwareCounters& n) {
+      forEach(n, [](auto& value, const auto& nValue) {
+        if (value and nValue and *nValue > 0) *value /= *nValue;
+      });
+      return *this;
+    }
+
+    /** \brief The number of samples of each counter, i.e. one for each counter which is read and empty otherwise */
+    HardwareCounters sampleCount() const {
+      HardwareCounters res = *this;
+      res.forEach(*this, [](auto& value, const auto&) {
+        if (value) value = 1.0;
+      });
+      return res;
+    }
+
+    /** \brief The instructions per cycle */
+    std::optional<double> ipc() const {
+      if (cycles and instructions and *cycles > 0) return *instructions / *cycles;
+      return std::nullopt;
+    }
+
+  private:
+    template <typename F>
+    void forEach(const HardwareCounters& other, F&& f) {
+      f(cycles, other.cycles);
+      f(instructions, other.instructions);
+      f(l1dMisses, other.l1dMisses);
+      f(llcMisses, other.llcMisses);
+      f(flops, other.flops);
+    }
+  };
+
+  /** \brief Reads the Linux hardware counters of the calling thread through perf_event_open.
+   *
+   * The counters are only opened if the environment variable DUNE_LOCALFEFUNCTIONS_PERF_COUNTERS is set to a value
+   * other than 0, since they perturb the timings slightly. Counters which cannot be opened, e.g. due to
+   * /proc/sys/kernel/perf_event_paranoid or a missing PMU in a virtual machine, stay empty. The retired floating point
+   * operations are only known for the FP_ARITH_INST_RETIRED events of Intel and RETIRED_SSE_AVX_FLOPS of AMD Zen, where
+   * only double precision is counted on Intel.
+   *
+   * The cycles, instructions and cache misses are opened as one event group and the floating point events as a second
+   * one. The events of a group are always scheduled together, thus ratios like the instructions per cycle are taken
+   * from the same time window. If the kernel multiplexes the groups, the values are extrapolated per group.
+   */
+  class PerfCounters {
+  public:
+    static PerfCounters& instance() {
+      static PerfCounters counters;
+      return counters;
+    }
+
+    bool enabled() const { return not groups.empty(); }
+
+    void start() {
+#ifdef DUNE_LOCALFEFUNCTIONS_HAVE_PERF_EVENT
+      for (auto& group : groups)
+        group.running = control(group, PERF_EVENT_IOC_RESET) and control(group, PERF_EVENT_IOC_ENABLE);
+#endif
+    }
+
+    HardwareCounters stop() {
+      HardwareCounters res;
+#ifdef DUNE_LOCALFEFUNCTIONS_HAVE_PERF_EVENT
+      for (auto& group : groups) {
+        const bool disabled = control(group, PERF_EVENT_IOC_DISABLE);
+        if (not group.running or not disabled) continue;
+        group.running = false;
+
+        // The layout of PERF_FORMAT_GROUP: nr, time_enabled, time_running, value[nr]
+        std::vector<std::uint64_t> data(3 + group.events.size());
+        const auto bytes = static_cast<ssize_t>(data.size() * sizeof(std::uint64_t));
+        if (read(group.events.front().fd, data.data(), bytes) != bytes or data[0] != group.events.size()
+            or data[2] == 0)
+          continue;
+        const double scaling = static_cast<double>(data[1]) / static_cast<double>(data[2]);
+        for (std::size_t i = 0; i < group.events.size(); ++i) {
+          const auto& event = group.events[i];
+          auto& counter     = res.*(event.counter);
+          counter           = counter.value_or(0.0) + event.weight * scaling * static_cast<double>(data[3 + i]);
+        }
+      }
+#endif
+      return res;
+    }
+
+    PerfCounters(const PerfCounters&)            = delete;
+    PerfCounters& operator=(const PerfCounters&) = delete;
+
+    ~PerfCounters() {
+#ifdef DUNE_LOCALFEFUNCTIONS_HAVE_PERF_EVENT
+      for (const auto& group : groups)
+        for (const auto& event : group.events)
+          close(event.fd);
+#endif
+    }
+
+  private:
+    struct Event {
+      int fd;
+      std::optional<double> HardwareCounters::*counter;
+      double weight;
+    };
+
+    /* The first event is the group leader, the values are read in the order of the events */
+    struct Group {
+      std::vector<Event> events;
+      bool running{false};
+    };
+
+    PerfCounters() {
+      const char* env = std::getenv("DUNE_LOCALFEFUNCTIONS_PERF_COUNTERS");
+      if (env == nullptr or std::string(env) == "0") return;
+#ifdef DUNE_LOCALFEFUNCTIONS_HAVE_PERF_EVENT
+      Group core;
+      open(core, PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES, &HardwareCounters::cycles);
+      open(core, PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS, &HardwareCounters::instructions);
+      open(core, PERF_TYPE_HW_CACHE,
+           PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16),
+           &HardwareCounters::l1dMisses);
+      open(core, PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES, &HardwareCounters::llcMisses);
+      if (not core.events.empty()) groups.push_back(std::move(core));
+
+      Group flops;
+      const std::string vendor = cpuVendor();
+      if (vendor == "GenuineIntel") {
+        /* FP_ARITH_INST_RETIRED with the umasks of scalar, 128, 256 and 512 bit double, FMAs count twice */
+        for (const auto& [umask, width] : {std::pair{0x01, 1.0}, {0x04, 2.0}, {0x10, 4.0}, {0x40, 8.0}})
+          open(flops, PERF_TYPE_RAW, 0xC7 | (umask << 8), &HardwareCounters::flops, width);
+      } else if (vendor == "AuthenticAMD")
+        open(flops, PERF_TYPE_RAW, 0x03 | (0xFF << 8), &HardwareCounters::flops);  // RETIRED_SSE_AVX_FLOPS, all types
+      if (not flops.events.empty()) groups.push_back(std::move(flops));
+
+      if (groups.empty())
+        std::cerr << "DUNE_LOCALFEFUNCTIONS_PERF_COUNTERS is set, but no hardware counter could be opened. Check "
+                     "/proc/sys/kernel/perf_event_paranoid."
+                  << std::endl;
+#else
+      std::cerr << "DUNE_LOCALFEFUNCTIONS_PERF_COUNTERS is set, but perf_event_open is only available on Linux."
+                << std::endl;
+#endif
+    }
+
+#ifdef DUNE_LOCALFEFUNCTIONS_HAVE_PERF_EVENT
+    /* Adds an event to the group, the first event which can be opened becomes the leader */
+    static void open(Group& group, std::uint32_t type, std::uint64_t config,
+                     std::optional<double> HardwareCounters::*counter, double weight = 1.0) {
+      const bool isLeader = group.events.empty();
+      perf_event_attr attr{};
+      attr.size           = sizeof(attr);
+      attr.type           = type;
+      attr.config         = config;
+      attr.disabled       = isLeader ? 1 : 0;
+      attr.exclude_kernel = 1;
+      attr.exclude_hv     = 1;
+      attr.read_format    = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+      const int groupFd   = isLeader ? -1 : group.events.front().fd;
+      const int fd        = static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, groupFd, 0));
+      if (fd >= 0) group.events.push_back({fd, counter, weight});
+    }
+
+    /* Applies the ioctl request to all events of the group, a failure is reported once */
+    bool control(const Group& group, unsigned long request) {
+      if (ioctl(group.events.front().fd, request, PERF_IOC_FLAG_GROUP) == 0) return true;
+      if (not controlFailureReported) {
+        std::cerr << "A hardware counter group could not be controlled: " << std::strerror(errno)
+                  << ". Its counters are left empty." << std::endl;
+        controlFailureReported = true;
+      }
+      return false;
+    }
+
+    static std::string cpuVendor() {
+      std::ifstream cpuinfo("/proc/cpuinfo");
+      for (std::string line; std::getline(cpuinfo, line);)
+        if (line.starts_with("vendor_id")) return line.substr(line.find(':') + 2);
+      return "";
+    }
+
+    bool controlFailureReported{false};
+#endif
+
+    std::vector<Group> groups;
+  };
+
+}  // namespace Dune::Benchmark
@@ -0,0 +1,10 @@
+// SPDX-FileCopyrightText: 2022 The dune-localfefunction developers mueller@ibb.uni-stuttgart.de
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <config.h>
+
+#include <dune/localfefunctions/cachedlocalBasis/cachedlocalBasisInstantiations.hh>
+
+namespace Dune {
+  DUNE_LOCALFEFUNCTIONS_CACHEDLOCALBASIS_INSTANTIATIONS();
+}  // namespace Dune
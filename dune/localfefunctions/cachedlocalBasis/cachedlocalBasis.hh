@@ -2,6 +2,8 @@
 // SPDX-License-Identifier: LGPL-2.1-or-later
 
 #pragma once
+#include <atomic>
+#include <cstdint>
 #include <ranges>
 #include <set>
 #include <vector>
@@ -24,6 +26,17 @@ namespace Dune {
     return std::set<int>({std::forward<Ints>(ints)...});
   }
 
+  template <int gridDim>
+  class MappedTabulation;
+
+  namespace Impl {
+    /* Returns a new identifier for each binding of a CachedLocalBasis */
+    inline std::uint64_t nextCachedLocalBasisBindingId() {
+      static std::atomic<std::uint64_t> id{0};
+      return ++id;
+    }
+  }  // namespace Impl
+
   /* Convenient wrapper to store a dune local basis. It is possible to precompute derivatives */
   template <Concepts::LocalBasis DuneLocalBasis>
   class CachedLocalBasis {
@@ -58,6 +71,14 @@ namespace Dune {
     /* Evaluates the ansatz functions and derivatives into the given Eigen Vector/Matrix N,dN */
     void evaluateFunctionAndJacobian(const DomainType& local, AnsatzFunctionType& N, JacobianType& dN) const;
 
+    /* Evaluates the ansatz functions into an internal buffer and returns a reference to it. The buffer is reused, thus
+     * after the first call no heap allocation takes place. The reference is invalidated by the next call */
+    const AnsatzFunctionType& evaluateFunction(const DomainType& local) const;
+
+    /* Evaluates the ansatz functions derivatives into an internal buffer and returns a reference to it. The buffer is
+     * reused, thus after the first call no heap allocation takes place. The reference is invalidated by the next call */
+    const JacobianType& evaluateJacobian(const DomainType& local) const;
+
     /* Returns the number of ansatz functions */
     unsigned int size() const { return duneLocalBasis->size(); }
 
@@ -73,6 +94,22 @@ namespace Dune {
     /* Binds this basis to a given integration rule */
     void bind(const Dune::QuadratureRule<DomainFieldType, gridDim>& p_rule, std::set<int>&& ints);
 
+    /* Binds this basis to the integration rule and the ansatz functions of a tabulation, which was saved by
+     * saveTabulation(). The tables are copied, thus the Dune basis is not evaluated, see tabulation.hh */
+    void bind(const MappedTabulation<gridDim>& tabulation);
+
+    /* Returns the integration rule, to which the basis is bound */
+    const Dune::QuadratureRule<DomainFieldType, gridDim>& integrationRule() const {
+      if (not rule) throw std::logic_error("You have to bind the basis first");
+      return rule.value();
+    }
+
+    /* Returns the derivative orders, which were precomputed by bind */
+    const std::set<int>& boundDerivativeOrders() const {
+      if (not boundDerivatives) throw std::logic_error("You have to bind the basis first");
+      return boundDerivatives.value();
+    }
+
     /* Returns a reference to the ansatz functions evaluated at the given integration point index
      * The "requires" statement is needed to circumvent implicit conversion from FieldVector<double,1>
      * */
@@ -95,6 +132,17 @@ namespace Dune {
       return ddNbound.value()[i];
     }
 
+    /* Identifies the binding of this basis, i.e. the integration rule and the ansatz functions evaluated at it. Each
+     * call to bind creates a new identifier, copies of the basis keep it. Zero means unbound. */
+    std::uint64_t bindingId() const { return bindingId_; }
+
+    /* Two cached bases are equal if they wrap the same Dune local basis and stem from the same binding, i.e. they
+     * return the same ansatz functions for every integration point index */
+    bool operator==(const CachedLocalBasis& other) const {
+      return duneLocalBasis == other.duneLocalBasis and boundDerivatives == other.boundDerivatives
+             and bindingId_ == other.bindingId_;
+    }
+
     /* Returns true if the local basis is currently bound to an integration rule */
     bool isBound(int i) const {
       if (i == 0) {
@@ -110,8 +158,8 @@ namespace Dune {
     struct FunctionAndJacobian {
       long unsigned index{};
       const Dune::QuadraturePoint<DomainFieldType, gridDim>& ip{};
-      const Eigen::VectorX<RangeFieldType>& N{};
-      const Dune::FieldMatrix<RangeFieldType, Eigen::Dynamic, gridDim>& dN{};
+      const AnsatzFunctionType& N{};
+      const JacobianType& dN{};
     };
 
     /* Returns a view over the integration point index, the point itself, and the ansatz function and ansatz function
@@ -119,9 +167,9 @@ namespace Dune {
     auto viewOverFunctionAndJacobian() const {
       assert(Nbound.value().size() == dNbound.value().size()
              && "Number of intergrationpoint evaluations does not match.");
-      if (isBound())
+      if (isBound(0) and isBound(1))
         return std::views::iota(0UL, Nbound.value().size()) | std::views::transform([&](auto&& i_) {
-                 return FunctionAndJacobian(i_, rule.value()[i_], getFunction(i_), getJacobian(i_));
+                 return FunctionAndJacobian{i_, rule.value()[i_], Nbound.value()[i_], dNbound.value()[i_]};
                });
       else {
         assert(false && "You need to call bind first");
@@ -156,14 +204,21 @@ namespace Dune {
     mutable std::vector<JacobianDuneType> dNdune{};
     mutable std::vector<RangeDuneType> ddNdune{};
     mutable std::vector<RangeDuneType> Ndune{};
+    mutable AnsatzFunctionType Nscratch{};
+    mutable JacobianType dNscratch{};
     DuneLocalBasis const* duneLocalBasis{nullptr};
     std::optional<std::set<int>> boundDerivatives;
     std::optional<std::vector<AnsatzFunctionType>> Nbound{};
     std::optional<std::vector<JacobianType>> dNbound{};
     std::optional<std::vector<SecondDerivativeType>> ddNbound{};
     std::optional<Dune::QuadratureRule<DomainFieldType, gridDim>> rule;
+    std::uint64_t bindingId_{0};
   };
 
 }  // namespace Dune
 
 #include "cachedlocalBasis.inl"
+
+#if DUNE_LOCALFEFUNCTIONS_EXPLICIT_INSTANTIATIONS == 1
+#  include "cachedlocalBasisInstantiations.hh"
+#endif
@@ -22,6 +22,20 @@ namespace Dune {
         coeff(dN,i,j) = dNdune[i][0][j];
   }
 
+  template <Concepts::LocalBasis DuneLocalBasis>
+  const typename CachedLocalBasis<DuneLocalBasis>::AnsatzFunctionType& CachedLocalBasis<DuneLocalBasis>::evaluateFunction(
+      const DomainType& local) const {
+    evaluateFunction(local, Nscratch);
+    return Nscratch;
+  }
+
+  template <Concepts::LocalBasis DuneLocalBasis>
+  const typename CachedLocalBasis<DuneLocalBasis>::JacobianType& CachedLocalBasis<DuneLocalBasis>::evaluateJacobian(
+      const DomainType& local) const {
+    evaluateJacobian(local, dNscratch);
+    return dNscratch;
+  }
+
   template <Concepts::LocalBasis DuneLocalBasis>
   const Dune::QuadraturePoint<typename CachedLocalBasis<DuneLocalBasis>::DomainFieldType, CachedLocalBasis<DuneLocalBasis>::gridDim>& CachedLocalBasis<DuneLocalBasis>::indexToIntegrationPoint(int i) const
   {
@@ -74,6 +88,7 @@ namespace Dune {
   void CachedLocalBasis<DuneLocalBasis>::bind(const Dune::QuadratureRule<DomainFieldType, gridDim>& p_rule, std::set<int>&& ints) {
     rule             = p_rule;
     boundDerivatives = ints;
+    bindingId_       = Impl::nextCachedLocalBasisBindingId();
     Nbound           = std::make_optional<typename decltype(Nbound)::value_type> ();
     dNbound           = std::make_optional<typename decltype(dNbound)::value_type> ();
     ddNbound           = std::make_optional<typename decltype(ddNbound)::value_type> ();
@@ -0,0 +1,47 @@
+// SPDX-FileCopyrightText: 2022 The dune-localfefunction developers mueller@ibb.uni-stuttgart.de
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#pragma once
+
+#include <dune/localfefunctions/cachedlocalBasis/cachedlocalBasis.hh>
+#include <dune/localfefunctions/cachedlocalBasis/tabulation.hh>
+#include <dune/localfunctions/lagrange/lagrangecube.hh>
+#include <dune/localfunctions/lagrange/lagrangesimplex.hh>
+
+/*
+ * The cached Lagrange bases of dune-localfunctions on cubes and simplices of dimension 1 to 3 with orders 1 to 3, which
+ * are compiled into the library dune-localfefunctions, if it is configured with DUNE_LOCALFEFUNCTIONS_ENABLE_LIBRARY.
+ * Then DUNE_LOCALFEFUNCTIONS_EXPLICIT_INSTANTIATIONS is defined by the config.h of this and of all dependent modules,
+ * see DuneLocalfefunctionsMacros.cmake, and by the library target. All other translation units only declare them.
+ *
+ * Only the out-of-line members, e.g. bind() and the evaluation of the Dune basis, are affected. The inline members and
+ * the member templates with deduced return types are still instantiated in each translation unit.
+ *
+ * The members of CachedLocalBasis depend on DefaultLinearAlgebra, thus the instantiations are only valid for the linear
+ * algebra backend of the library. The library target exports it as DUNE_LOCALFEFUNCTIONS_LIBRARY_USE_EIGEN and a
+ * translation unit with another backend is rejected, since both would define the same specializations differently.
+ */
+#define DUNE_LOCALFEFUNCTIONS_CACHEDLOCALBASIS_INSTANTIATION(prefix, dim, order)                \
+  prefix template class CachedLocalBasis<Impl::LagrangeCubeLocalBasis<double, double, dim, order>>; \
+  prefix template class CachedLocalBasis<Impl::LagrangeSimplexLocalBasis<double, double, dim, order>>
+
+#define DUNE_LOCALFEFUNCTIONS_CACHEDLOCALBASIS_INSTANTIATIONS(prefix) \
+  DUNE_LOCALFEFUNCTIONS_CACHEDLOCALBASIS_INSTANTIATION(prefix, 1, 1); \
+  DUNE_LOCALFEFUNCTIONS_CACHEDLOCALBASIS_INSTANTIATION(prefix, 1, 2); \
+  DUNE_LOCALFEFUNCTIONS_CACHEDLOCALBASIS_INSTANTIATION(prefix, 1, 3); \
+  DUNE_LOCALFEFUNCTIONS_CACHEDLOCALBASIS_INSTANTIATION(prefix, 2, 1); \
+  DUNE_LOCALFEFUNCTIONS_CACHEDLOCALBASIS_INSTANTIATION(prefix, 2, 2); \
+  DUNE_LOCALFEFUNCTIONS_CACHEDLOCALBASIS_INSTANTIATION(prefix, 2, 3); \
+  DUNE_LOCALFEFUNCTIONS_CACHEDLOCALBASIS_INSTANTIATION(prefix, 3, 1); \
+  DUNE_LOCALFEFUNCTIONS_CACHEDLOCALBASIS_INSTANTIATION(prefix, 3, 2); \
+  DUNE_LOCALFEFUNCTIONS_CACHEDLOCALBASIS_INSTANTIATION(prefix, 3, 3)
+
+#if DUNE_LOCALFEFUNCTIONS_EXPLICIT_INSTANTIATIONS == 1
+#  if defined(DUNE_LOCALFEFUNCTIONS_LIBRARY_USE_EIGEN) \
+      && (DUNE_LOCALFEFUNCTIONS_LIBRARY_USE_EIGEN == 1) != (DUNE_LOCALFEFUNCTIONS_USE_EIGEN == 1)
+#    error "The library dune-localfefunctions was built with another linear algebra backend."
+#  endif
+namespace Dune {
+  DUNE_LOCALFEFUNCTIONS_CACHEDLOCALBASIS_INSTANTIATIONS(extern);
+}  // namespace Dune
+#endif
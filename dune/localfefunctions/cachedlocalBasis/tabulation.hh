@@ -0,0 +1,405 @@
+// SPDX-FileCopyrightText: 2022 The dune-localfefunction developers mueller@ibb.uni-stuttgart.de
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <limits>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#if __has_include(<sys/mman.h>)
+#  define DUNE_LOCALFEFUNCTIONS_HAVE_MMAP 1
+#  include <fcntl.h>
+#  include <sys/mman.h>
+#  include <sys/stat.h>
+#  include <unistd.h>
+#endif
+
+#include <dune/common/exceptions.hh>
+#include <dune/common/fvector.hh>
+#include <dune/geometry/quadraturerules.hh>
+#include <dune/geometry/referenceelements.hh>
+#include <dune/geometry/type.hh>
+#include <dune/localfefunctions/cachedlocalBasis/cachedlocalBasis.hh>
+
+#include <Eigen/Core>
+
+/*
+ * A binary format of the tables of a bound CachedLocalBasis, such that repeated runs and all ranks on one node can map
+ * the same file instead of evaluating the Dune basis at each integration point.
+ *
+ * The file starts with a TabulationHeader, followed by the sections of the integration point positions, the weights,
+ * the ansatz functions N, their derivatives dN and their second derivatives ddN. Each section starts at a multiple of
+ * TabulationHeader::alignment. The tables are stored per integration point in column-major order, i.e. as
+ * Eigen::VectorXd, Eigen::Matrix<double, Eigen::Dynamic, gridDim> and Eigen::Matrix<double, Eigen::Dynamic, voigt>.
+ * Sections of derivatives, which are not bound, are empty. The format is versioned and a file with a different version,
+ * byte order or scalar size is rejected.
+ */
+namespace Dune {
+
+  /** \brief The header of a tabulation file */
+  struct TabulationHeader {
+    static constexpr std::array<char, 8> magicValue{'D', 'L', 'F', 'F', 'T', 'A', 'B', '\0'};
+    static constexpr std::uint32_t currentVersion = 1;
+    static constexpr std::uint32_t byteOrderMark  = 0x01020304;
+    static constexpr std::size_t alignment        = 64;
+
+    std::array<char, 8> magic{magicValue};
+    std::uint32_t version{currentVersion};
+    std::uint32_t byteOrder{byteOrderMark};
+    std::uint32_t scalarSize{sizeof(double)};
+    std::uint32_t gridDim{};
+    std::uint32_t topologyId{};
+    std::int32_t quadratureOrder{};
+    std::uint32_t basisOrder{};
+    /** \brief The bit k is set, if the derivatives of order k are tabulated */
+    std::uint32_t boundDerivatives{};
+    std::uint64_t ansatzFunctions{};
+    std::uint64_t integrationPoints{};
+
+    bool isBound(int derivativeOrder) const { return boundDerivatives & (1U << derivativeOrder); }
+  };
+  static_assert(std::is_trivially_copyable_v<TabulationHeader>
+                and sizeof(TabulationHeader) <= TabulationHeader::alignment);
+
+  namespace Impl {
+    /* The byte offsets of the sections of a tabulation file. The sizes in the header are untrusted, thus all sizes are
+     * computed with overflow checks, such that a corrupted header cannot wrap the offsets below the file size. */
+    struct TabulationLayout {
+      explicit TabulationLayout(const TabulationHeader& header) {
+        const std::size_t nip       = checkedSize(header.integrationPoints);
+        const std::size_t n         = checkedSize(header.ansatzFunctions);
+        const std::size_t voigtSize = header.gridDim * (header.gridDim + 1) / 2;
+        std::size_t offset          = TabulationHeader::alignment;
+        auto section                = [&](std::size_t doubles) {
+          const std::size_t begin = offset;
+          const std::size_t bytes = checkedProduct(doubles, sizeof(double));
+          const std::size_t pad   = (TabulationHeader::alignment - bytes % TabulationHeader::alignment)
+                                  % TabulationHeader::alignment;
+          offset = checkedSum(checkedSum(offset, bytes), pad);
+          return begin;
+        };
+        positions         = section(checkedProduct(nip, header.gridDim));
+        weights           = section(nip);
+        function          = section(header.isBound(0) ? checkedProduct(nip, n) : 0);
+        jacobian          = section(header.isBound(1) ? checkedProduct(checkedProduct(nip, n), header.gridDim) : 0);
+        secondDerivatives = section(header.isBound(2) ? checkedProduct(checkedProduct(nip, n), voigtSize) : 0);
+        fileSize          = offset;
+      }
+
+      std::size_t positions, weights, function, jacobian, secondDerivatives, fileSize;
+
+    private:
+      static std::size_t checkedSize(std::uint64_t a) {
+        if (a > std::numeric_limits<std::size_t>::max()) overflow();
+        return static_cast<std::size_t>(a);
+      }
+
+      static std::size_t checkedProduct(std::size_t a, std::size_t b) {
+        if (b != 0 and a > std::numeric_limits<std::size_t>::max() / b) overflow();
+        return a * b;
+      }
+
+      static std::size_t checkedSum(std::size_t a, std::size_t b) {
+        if (a > std::numeric_limits<std::size_t>::max() - b) overflow();
+        return a + b;
+      }
+
+      [[noreturn]] static void overflow() {
+        DUNE_THROW(Dune::IOError, "The sizes of the tabulation exceed the addressable memory");
+      }
+    };
+  }  // namespace Impl
+
+  /** \brief Writes the integration rule and the bound ansatz functions and derivatives of the basis to a file */
+  template <Concepts::LocalBasis DuneLocalBasis>
+  void saveTabulation(const CachedLocalBasis<DuneLocalBasis>& basis, const std::string& fileName) {
+    constexpr int gridDim   = CachedLocalBasis<DuneLocalBasis>::gridDim;
+    constexpr int voigtSize = gridDim * (gridDim + 1) / 2;
+    const auto& rule        = basis.integrationRule();
+    TabulationHeader header;
+    header.gridDim           = gridDim;
+    header.topologyId        = rule.type().id();
+    header.quadratureOrder   = rule.order();
+    header.basisOrder        = basis.order();
+    header.ansatzFunctions   = basis.size();
+    header.integrationPoints = rule.size();
+    for (int derivativeOrder : basis.boundDerivativeOrders())
+      if (derivativeOrder <= 2) header.boundDerivatives |= 1U << derivativeOrder;
+
+    const Impl::TabulationLayout layout(header);
+    const std::size_t n = header.ansatzFunctions;
+    std::vector<char> data(layout.fileSize, 0);
+    std::memcpy(data.data(), &header, sizeof(header));
+    auto put = [&](std::size_t section, std::size_t index, double value) {
+      std::memcpy(data.data() + section + index * sizeof(double), &value, sizeof(double));
+    };
+
+    for (std::size_t i = 0; i < rule.size(); ++i) {
+      for (int d = 0; d < gridDim; ++d)
+        put(layout.positions, i * gridDim + d, rule[i].position()[d]);
+      put(layout.weights, i, rule[i].weight());
+      if (header.isBound(0)) {
+        const auto& N = basis.evaluateFunction(i);
+        for (std::size_t k = 0; k < n; ++k)
+          put(layout.function, i * n + k, N[k]);
+      }
+      if (header.isBound(1)) {
+        const auto& dN = basis.evaluateJacobian(i);
+        for (int d = 0; d < gridDim; ++d)
+          for (std::size_t k = 0; k < n; ++k)
+            put(layout.jacobian, (i * gridDim + d) * n + k, coeff(dN, k, d));
+      }
+      if (header.isBound(2)) {
+        const auto& ddN = basis.evaluateSecondDerivatives(i);
+        for (int d = 0; d < voigtSize; ++d)
+          for (std::size_t k = 0; k < n; ++k)
+            put(layout.secondDerivatives, (i * voigtSize + d) * n + k, coeff(ddN, k, d));
+      }
+    }
+
+    std::ofstream out(fileName, std::ios::binary | std::ios::trunc);
+    out.write(data.data(), static_cast<std::streamsize>(data.size()));
+    if (not out) DUNE_THROW(Dune::IOError, "Could not write the tabulation " + fileName);
+  }
+
+  /** \brief A read-only view of a tabulation file, which was written by saveTabulation().
+   *
+   * The file is mapped into memory, thus the evaluations are views into the page cache, which is shared by all
+   * processes, which map the same file. If the platform does not provide mmap, the file is read into a buffer. The
+   * views are valid as long as this object lives.
+   */
+  template <int gridDim>
+  class MappedTabulation {
+  public:
+    static constexpr int voigtSize = gridDim * (gridDim + 1) / 2;
+    using FunctionType             = Eigen::Map<const Eigen::VectorXd>;
+    using JacobianType             = Eigen::Map<const Eigen::Matrix<double, Eigen::Dynamic, gridDim>>;
+    using SecondDerivativeType     = Eigen::Map<const Eigen::Matrix<double, Eigen::Dynamic, voigtSize>>;
+
+    explicit MappedTabulation(const std::string& fileName) {
+#ifdef DUNE_LOCALFEFUNCTIONS_HAVE_MMAP
+      const int fd = ::open(fileName.c_str(), O_RDONLY);
+      if (fd < 0) DUNE_THROW(Dune::IOError, "Could not open the tabulation " + fileName);
+      struct stat status {};
+      if (::fstat(fd, &status) == 0 and status.st_size > 0) {
+        size_ = static_cast<std::size_t>(status.st_size);
+        void* mapped = ::mmap(nullptr, size_, PROT_READ, MAP_SHARED, fd, 0);
+        if (mapped != MAP_FAILED) data_ = static_cast<const char*>(mapped);
+      }
+      ::close(fd);
+      if (data_ == nullptr) DUNE_THROW(Dune::IOError, "Could not map the tabulation " + fileName);
+#else
+      std::ifstream in(fileName, std::ios::binary);
+      if (not in) DUNE_THROW(Dune::IOError, "Could not open the tabulation " + fileName);
+      buffer_.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+      data_ = buffer_.data();
+      size_ = buffer_.size();
+#endif
+      try {
+        validate(fileName);
+      } catch (...) {
+        release();
+        throw;
+      }
+    }
+
+    MappedTabulation(const MappedTabulation&)            = delete;
+    MappedTabulation& operator=(const MappedTabulation&) = delete;
+
+    MappedTabulation(MappedTabulation&& other) noexcept
+        : data_{std::exchange(other.data_, nullptr)},
+          size_{std::exchange(other.size_, 0)},
+          buffer_{std::move(other.buffer_)},
+          header_{other.header_},
+          layout_{other.layout_} {}
+
+    MappedTabulation& operator=(MappedTabulation&& other) noexcept {
+      if (this != &other) {
+        release();
+        data_   = std::exchange(other.data_, nullptr);
+        size_   = std::exchange(other.size_, 0);
+        buffer_ = std::move(other.buffer_);
+        header_ = other.header_;
+        layout_ = other.layout_;
+      }
+      return *this;
+    }
+
+    ~MappedTabulation() { release(); }
+
+    const TabulationHeader& header() const { return header_; }
+
+    /* Returns the number of ansatz functions */
+    std::size_t size() const { return header_.ansatzFunctions; }
+
+    /* Returns the number of integration points */
+    std::size_t integrationPointSize() const { return header_.integrationPoints; }
+
+    /* Returns true if the derivatives of the given order are tabulated */
+    bool isBound(int derivativeOrder) const { return header_.isBound(derivativeOrder); }
+
+    /* Returns the integration rule of the tabulation */
+    Dune::QuadratureRule<double, gridDim> integrationRule() const {
+      Dune::QuadratureRule<double, gridDim> res(Dune::GeometryType(header_.topologyId, gridDim),
+                                                header_.quadratureOrder);
+      for (std::size_t i = 0; i < integrationPointSize(); ++i) {
+        Dune::FieldVector<double, gridDim> position;
+        for (int d = 0; d < gridDim; ++d)
+          position[d] = section(layout_.positions)[i * gridDim + d];
+        res.emplace_back(position, section(layout_.weights)[i]);
+      }
+      return res;
+    }
+
+    /* Returns a view of the ansatz functions at the given integration point index */
+    FunctionType evaluateFunction(std::size_t ipIndex) const {
+      checkBound(0);
+      return FunctionType(section(layout_.function) + ipIndex * size(), size());
+    }
+
+    /* Returns a view of the ansatz functions derivatives at the given integration point index */
+    JacobianType evaluateJacobian(std::size_t ipIndex) const {
+      checkBound(1);
+      return JacobianType(section(layout_.jacobian) + ipIndex * size() * gridDim, size(), gridDim);
+    }
+
+    /* Returns a view of the ansatz functions second derivatives at the given integration point index */
+    SecondDerivativeType evaluateSecondDerivatives(std::size_t ipIndex) const {
+      checkBound(2);
+      return SecondDerivativeType(section(layout_.secondDerivatives) + ipIndex * size() * voigtSize, size(),
+                                  voigtSize);
+    }
+
+  private:
+    void validate(const std::string& fileName) {
+      if (size_ < sizeof(TabulationHeader))
+        DUNE_THROW(Dune::IOError, fileName + " is too small to be a tabulation");
+      std::memcpy(&header_, data_, sizeof(TabulationHeader));
+      if (header_.magic != TabulationHeader::magicValue) DUNE_THROW(Dune::IOError, fileName + " is not a tabulation");
+      if (header_.version != TabulationHeader::currentVersion)
+        DUNE_THROW(Dune::IOError, fileName + " has the unsupported tabulation version "
+                                      + std::to_string(header_.version) + ", expected "
+                                      + std::to_string(TabulationHeader::currentVersion));
+      if (header_.byteOrder != TabulationHeader::byteOrderMark or header_.scalarSize != sizeof(double))
+        DUNE_THROW(Dune::IOError, fileName + " was written on a platform with a different byte order or scalar size");
+      if (header_.gridDim != gridDim)
+        DUNE_THROW(Dune::IOError, fileName + " is a tabulation for the grid dimension "
+                                      + std::to_string(header_.gridDim) + ", expected " + std::to_string(gridDim));
+      if (header_.topologyId >= (1U << gridDim))
+        DUNE_THROW(Dune::IOError, fileName + " has the invalid topology id " + std::to_string(header_.topologyId)
+                                      + " for the grid dimension " + std::to_string(gridDim));
+      layout_ = Impl::TabulationLayout(header_);
+      if (size_ < layout_.fileSize) DUNE_THROW(Dune::IOError, fileName + " is truncated");
+
+      const auto type = Dune::GeometryType(header_.topologyId, gridDim);
+      for (const auto& ip : integrationRule())
+        if (not Dune::referenceElement<double, gridDim>(type).checkInside(ip.position()))
+          DUNE_THROW(Dune::IOError,
+                     fileName + " has integration points outside of its reference element " + type.name());
+    }
+
+    void checkBound(int derivativeOrder) const {
+      if (not isBound(derivativeOrder))
+        throw std::logic_error("The derivatives of order " + std::to_string(derivativeOrder) + " are not tabulated");
+    }
+
+    const double* section(std::size_t offset) const { return reinterpret_cast<const double*>(data_ + offset); }
+
+    void release() {
+#ifdef DUNE_LOCALFEFUNCTIONS_HAVE_MMAP
+      if (data_ != nullptr) ::munmap(const_cast<char*>(data_), size_);
+#endif
+      data_ = nullptr;
+      size_ = 0;
+      buffer_.clear();
+    }
+
+    const char* data_{nullptr};
+    std::size_t size_{0};
+    std::vector<char> buffer_;
+    TabulationHeader header_{};
+    Impl::TabulationLayout layout_{TabulationHeader{}};
+  };
+
+  template <Concepts::LocalBasis DuneLocalBasis>
+  void CachedLocalBasis<DuneLocalBasis>::bind(const MappedTabulation<gridDim>& tabulation) {
+    if (tabulation.size() != size() or tabulation.header().basisOrder != order())
+      throw std::logic_error("The tabulation was not written for a basis of this size and order");
+    auto tabulatedRule = tabulation.integrationRule();
+
+    // The Dune basis does not know its reference element. If it was bound before, the topology of that rule is the one
+    // of the basis. In addition, the tabulated ansatz functions or derivatives at the first integration point have to
+    // coincide with the ones of the basis.
+    if (rule and rule.value().type() != tabulatedRule.type())
+      throw std::logic_error("The tabulation for the topology id " + std::to_string(tabulation.header().topologyId)
+                             + " does not match the topology id " + std::to_string(rule.value().type().id())
+                             + " of this basis");
+    if (not tabulatedRule.empty() and (tabulation.isBound(0) or tabulation.isBound(1))) {
+      const auto& position = tabulatedRule[0].position();
+      double difference    = 0.0;
+      if (tabulation.isBound(0)) {
+        AnsatzFunctionType N;
+        evaluateFunction(position, N);
+        const auto tabulatedN = tabulation.evaluateFunction(0);
+        for (std::size_t k = 0; k < size(); ++k)
+          difference = std::max(difference, std::abs(N[k] - tabulatedN[k]));
+      } else {
+        JacobianType dN;
+        evaluateJacobian(position, dN);
+        const auto tabulatedDN = tabulation.evaluateJacobian(0);
+        for (std::size_t k = 0; k < size(); ++k)
+          for (int d = 0; d < gridDim; ++d)
+            difference = std::max(difference, std::abs(coeff(dN, k, d) - tabulatedDN(k, d)));
+      }
+      if (difference > 1e-10)
+        throw std::logic_error("The tabulation for the topology id " + std::to_string(tabulation.header().topologyId)
+                               + " does not match this basis");
+    }
+
+    rule             = std::move(tabulatedRule);
+    boundDerivatives = std::set<int>();
+    bindingId_       = Impl::nextCachedLocalBasisBindingId();
+    for (int derivativeOrder = 0; derivativeOrder <= 2; ++derivativeOrder)
+      if (tabulation.isBound(derivativeOrder)) boundDerivatives.value().insert(derivativeOrder);
+    Nbound   = std::make_optional<typename decltype(Nbound)::value_type>(rule.value().size());
+    dNbound  = std::make_optional<typename decltype(dNbound)::value_type>(rule.value().size());
+    ddNbound = std::make_optional<typename decltype(ddNbound)::value_type>(rule.value().size());
+
+    const std::size_t n = size();
+    for (std::size_t i = 0; i < rule.value().size(); ++i) {
+      if (tabulation.isBound(0)) {
+        const auto N = tabulation.evaluateFunction(i);
+        Nbound.value()[i].resize(n);
+        for (std::size_t k = 0; k < n; ++k)
+          Nbound.value()[i][k] = N[k];
+      }
+      if (tabulation.isBound(1)) {
+        const auto dN = tabulation.evaluateJacobian(i);
+        resize(dNbound.value()[i], n);
+        for (std::size_t k = 0; k < n; ++k)
+          for (int d = 0; d < gridDim; ++d)
+            coeff(dNbound.value()[i], k, d) = dN(k, d);
+      }
+      if (tabulation.isBound(2)) {
+        const auto ddN = tabulation.evaluateSecondDerivatives(i);
+        resize(ddNbound.value()[i], n);
+        for (std::size_t k = 0; k < n; ++k)
+          for (int d = 0; d < gridDim * (gridDim + 1) / 2; ++d)
+            coeff(ddNbound.value()[i], k, d) = ddN(k, d);
+      }
+    }
+  }
+
+}  // namespace Dune
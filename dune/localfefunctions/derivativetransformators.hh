@@ -29,8 +29,9 @@ namespace Dune {
 
     Eigen::Matrix<ScalarType, 2, 2> invJT;
     invJT << A1.dot(A1loc), A1.dot(A2loc), A2.dot(A1loc), A2.dot(A2loc);
+    const Eigen::Matrix<ScalarType, 2, 2> invJTInverse = invJT.inverse();
 
-    dNTransformed = dN * invJT.inverse().eval();
+    dNTransformed.noalias() = dN.lazyProduct(invJTInverse);
   }
 
   template <typename ScalarType, int worldDim, int GridDim, int Options, int MaxWorldDim, int MaxGridDim>
@@ -40,9 +41,10 @@ namespace Dune {
       Eigen::Matrix<ScalarType, Eigen::Dynamic, GridDim> &dNTransformed) noexcept {
     const Eigen::Matrix<ScalarType, worldDim, GridDim> A1andA2Ortho = Dune::orthonormalizeMatrixColumns(A1andA2);
 
-    Eigen::Matrix<ScalarType, GridDim, GridDim> invJT = A1andA2.transpose() * A1andA2Ortho;
+    const Eigen::Matrix<ScalarType, GridDim, GridDim> invJT        = A1andA2.transpose() * A1andA2Ortho;
+    const Eigen::Matrix<ScalarType, GridDim, GridDim> invJTInverse = invJT.inverse();
 
-    dNTransformed = dN * invJT.inverse().eval();
+    dNTransformed.noalias() = dN.lazyProduct(invJTInverse);
   }
 
   struct DefaultFirstOrderTransformFunctor {
@@ -50,8 +52,8 @@ namespace Dune {
     void operator()(const Geometry &geo, const LocalCoord &gp, const DerivativeMatrix &dN,
                     DerivativeMatrix &dNTransformed) const {
       if constexpr (Geometry::coorddimension == Geometry::mydimension) {
-        const auto jInv = toEigen(geo.jacobianTransposed(gp)).eval().inverse().transpose().eval();
-        dNTransformed   = dN * jInv;
+        const auto jInv         = toEigen(geo.jacobianTransposed(gp)).eval().inverse().transpose().eval();
+        dNTransformed.noalias() = dN.lazyProduct(jInv);
       } else if constexpr (Geometry::mydimension == 2
                            and Geometry::coorddimension == 3) {  // two-dimensional grid element in 3D space
         const auto j = toEigen(geo.jacobianTransposed(gp)).transpose().eval();
@@ -65,8 +67,8 @@ namespace Dune {
     void operator()(const Geometry &geo, const LocalCoord &gp, const DerivativeMatrix &dN,
                     DerivativeMatrix &dNTransformed) const {
       if constexpr (Geometry::coorddimension == Geometry::mydimension) {
-        const auto jInv = toEigen(geo.jacobianTransposed(gp)).eval().inverse().transpose().eval();
-        dNTransformed   = dN * jInv;
+        const auto jInv         = toEigen(geo.jacobianTransposed(gp)).eval().inverse().transpose().eval();
+        dNTransformed.noalias() = dN.lazyProduct(jInv);
       } else {
         const auto j = toEigen(geo.jacobianTransposed(gp)).transpose().eval();
         calcCartesianDerivativesByGramSchmidt(dN, j, dNTransformed);
@@ -106,7 +108,7 @@ namespace Dune {
     invJT[1][0] = A2 * A1loc;
     invJT[1][1] = A2 * A2loc;
 
-    dNTransformed.resize(dN.size());
+    if (dNTransformed.size() != dN.size()) dNTransformed.resize(dN.size());
     for (size_t i = 0; i < dN.size(); ++i)
       invJT.mv(dN[i], dNTransformed[i]);
   }
@@ -120,7 +122,7 @@ namespace Dune {
 
     Dune::FieldMatrix<ScalarType, GridDim, GridDim> invJT = (transpose(A1andA2) * A1andA2Ortho);
     invJT.invert();
-    dNTransformed.resize(dN.size());
+    if (dNTransformed.size() != dN.size()) dNTransformed.resize(dN.size());
     for (size_t i = 0; i < dN.size(); ++i)
       invJT.mv(dN[i], dNTransformed[i]);
   }
@@ -131,7 +133,7 @@ namespace Dune {
                     DerivativeMatrix &dNTransformed) const {
       if constexpr (Geometry::coorddimension == Geometry::mydimension) {
         const auto jInv = geo.jacobianInverseTransposed(gp);
-        dNTransformed.resize(dN.size());
+        if (dNTransformed.size() != dN.size()) dNTransformed.resize(dN.size());
         for (size_t i = 0; i < dN.size(); ++i)
           jInv.mv(dN[i], dNTransformed[i]);
       } else if constexpr (Geometry::mydimension == 2
@@ -148,7 +150,7 @@ namespace Dune {
                     DerivativeMatrix &dNTransformed) const {
       if constexpr (Geometry::coorddimension == Geometry::mydimension) {
         const auto jInv = geo.jacobianInverseTransposed(gp);
-        dNTransformed.resize(dN.size());
+        if (dNTransformed.size() != dN.size()) dNTransformed.resize(dN.size());
         for (size_t i = 0; i < dN.size(); ++i)
           jInv.mv(dN[i], dNTransformed[i]);
       } else {
@@ -0,0 +1,157 @@
+// SPDX-FileCopyrightText: 2022 The dune-localfefunction developers mueller@ibb.uni-stuttgart.de
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#pragma once
+
+#include <array>
+#include <optional>
+#include <tuple>
+#include <type_traits>
+
+/* The number of nodes of the same type, for which results are kept, see EvaluationMemo */
+#ifndef DUNE_LOCALFEFUNCTIONS_EVALUATION_MEMO_NODES
+#  define DUNE_LOCALFEFUNCTIONS_EVALUATION_MEMO_NODES 8
+#endif
+
+namespace Dune {
+
+  namespace Impl {
+    /* Counts the evaluations started on this thread. Results memoized during an earlier evaluation are never reused,
+     * since the coefficients of the local functions may have changed in between. */
+    inline thread_local std::size_t evaluationCounter{0};
+
+    template <typename DomainTypeOrIntegrationPointIndex>
+    struct EvaluationMemoKey {
+      const void* node{};
+      std::size_t evaluation{};
+      DomainTypeOrIntegrationPointIndex integrationPointOrIndex{};
+      std::array<std::size_t, 3> derivativeIndices{};
+
+      bool operator==(const EvaluationMemoKey& other) const {
+        return node == other.node and evaluation == other.evaluation and derivativeIndices == other.derivativeIndices
+               and integrationPointOrIndex == other.integrationPointOrIndex;
+      }
+    };
+
+    /* The results of the nodes evaluated last for each node type, derivative signature and result type. Each node
+     * gets its own group of a few entries, since e.g. the second derivative w.r.t. coefficients i and j needs the first
+     * derivatives of the subexpressions w.r.t. i and j. Thus, nodes of the same type, e.g. the two sums in
+     * dot(f + g, g + h), do not evict each others results. The least recently used group and the least recently used
+     * entry within a group are replaced. */
+    template <typename DomainTypeOrIntegrationPointIndex, typename Result>
+    struct EvaluationMemo {
+      static constexpr std::size_t nodes          = DUNE_LOCALFEFUNCTIONS_EVALUATION_MEMO_NODES;
+      static constexpr std::size_t entriesPerNode = 4;
+
+      const Result* find(const EvaluationMemoKey<DomainTypeOrIntegrationPointIndex>& key) {
+        for (auto& group : groups) {
+          if (group.node != key.node) continue;
+          for (std::size_t i = 0; i < entriesPerNode; ++i)
+            if (group.entries[i] and group.entries[i]->first == key) {
+              group.lastUse = group.entryLastUse[i] = ++uses;
+              return &group.entries[i]->second;
+            }
+          return nullptr;
+        }
+        return nullptr;
+      }
+
+      void insert(const EvaluationMemoKey<DomainTypeOrIntegrationPointIndex>& key, const Result& result) {
+        Group* group = &groups[0];
+        for (auto& candidate : groups) {
+          if (candidate.node == key.node) {
+            group = &candidate;
+            break;
+          }
+          if (candidate.lastUse < group->lastUse) group = &candidate;
+        }
+        if (group->node != key.node) *group = Group{key.node};
+        std::size_t leastRecentlyUsed = 0;
+        for (std::size_t i = 1; i < entriesPerNode; ++i)
+          if (group->entryLastUse[i] < group->entryLastUse[leastRecentlyUsed]) leastRecentlyUsed = i;
+        group->entries[leastRecentlyUsed].emplace(key, result);
+        group->lastUse = group->entryLastUse[leastRecentlyUsed] = ++uses;
+      }
+
+    private:
+      using Entry = std::pair<EvaluationMemoKey<DomainTypeOrIntegrationPointIndex>, Result>;
+      struct Group {
+        const void* node{};
+        std::array<std::optional<Entry>, entriesPerNode> entries{};
+        std::array<std::size_t, entriesPerNode> entryLastUse{};
+        std::size_t lastUse{0};
+      };
+      std::array<Group, nodes> groups{};
+      std::size_t uses{0};
+    };
+
+    /* The depth of the node currently evaluated on this thread, where zero is the root of the expression */
+    inline thread_local int evaluationDepth{0};
+
+    struct EvaluationDepthGuard {
+      EvaluationDepthGuard() { ++evaluationDepth; }
+      ~EvaluationDepthGuard() { --evaluationDepth; }
+      EvaluationDepthGuard(const EvaluationDepthGuard&)            = delete;
+      EvaluationDepthGuard& operator=(const EvaluationDepthGuard&) = delete;
+    };
+
+    template <typename Node, typename Signature, typename DomainTypeOrIntegrationPointIndex, typename Result>
+    inline thread_local EvaluationMemo<DomainTypeOrIntegrationPointIndex, Result> evaluationMemo{};
+
+    /* The runtime part of the derivative signature, i.e. the coefficient indices and the spatial direction */
+    template <typename LFArgs>
+    std::array<std::size_t, 3> derivativeIndices(const LFArgs& lfArgs) {
+      std::array<std::size_t, 3> indices{};
+      if constexpr (LFArgs::hasSingleCoeff)
+        indices[0] = lfArgs.coeffsIndices[1];
+      else if constexpr (LFArgs::hasTwoCoeff) {
+        indices[0] = lfArgs.coeffsIndices.first[1];
+        indices[1] = lfArgs.coeffsIndices.second[1];
+      }
+      if constexpr (LFArgs::hasOneSpatialSingle) indices[2] = lfArgs.spatialPartialIndices;
+      return indices;
+    }
+  }  // namespace Impl
+
+  /** \brief Starts a new evaluation of a local function. All results memoized before are discarded. */
+  inline void startNewEvaluation() { ++Impl::evaluationCounter; }
+
+  /** \brief Evaluates a node of an expression tree only once per evaluation of the whole tree.
+   *
+   * Expressions evaluate the values and derivatives of their subexpressions many times, e.g. the derivative of a dot
+   * product needs the values and first derivatives of both factors for every term of the product rule. The result is
+   * memoized for the node, the integration point and the derivative signature, i.e. the derivative directions and the
+   * transformation. The memo is reset by startNewEvaluation(), which is called by each evaluation of a local function
+   * from outside. Derivatives along given directions are not memoized, since expressions replace the along arguments
+   * for their subexpressions. The root of the expression is evaluated only once per evaluation, thus its result is
+   * not copied into the memo.
+   */
+  template <bool isValue, typename Node, typename LFArgs, typename Evaluate>
+  auto memoizedEvaluation(const Node& node, const LFArgs& lfArgs, Evaluate&& evaluate) {
+    using Result = decltype(evaluate());
+    constexpr bool hasAlong
+        = std::tuple_size_v<typename std::remove_cvref_t<decltype(lfArgs.alongArgs)>::Args> != 0;
+    const bool isRoot = Impl::evaluationDepth == 0;
+    Impl::EvaluationDepthGuard depthGuard;
+    if constexpr ((not isValue and hasAlong) or not std::is_trivially_destructible_v<Result>
+                  or not std::is_copy_assignable_v<Result>)
+      return evaluate();
+    else {
+      if (isRoot) return evaluate();
+
+      using WrtSignature = std::conditional_t<isValue, void, std::remove_cvref_t<decltype(lfArgs.wrtArgs)>>;
+      using Signature    = std::tuple<WrtSignature*, std::remove_cvref_t<decltype(lfArgs.transformWithArgs)>>;
+      using Position     = std::remove_cvref_t<decltype(lfArgs.integrationPointOrIndex)>;
+      auto& memo         = Impl::evaluationMemo<Node, Signature, Position, Result>;
+
+      Impl::EvaluationMemoKey<Position> key{&node, Impl::evaluationCounter, lfArgs.integrationPointOrIndex, {}};
+      if constexpr (not isValue) key.derivativeIndices = Impl::derivativeIndices(lfArgs);
+
+      if (const Result* memoized = memo.find(key)) return *memoized;
+      Result result = evaluate();
+      memo.insert(key, result);
+      return result;
+    }
+  }
+
+}  // namespace Dune
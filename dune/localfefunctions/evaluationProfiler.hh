@@ -0,0 +1,149 @@
+// SPDX-FileCopyrightText: 2022 The dune-localfefunction developers mueller@ibb.uni-stuttgart.de
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#pragma once
+
+#include <chrono>
+#include <deque>
+#include <ostream>
+#include <string>
+
+#if DUNE_LOCALFEFUNCTIONS_ENABLE_PROFILING == 1
+#  include <tuple>
+#  include <type_traits>
+#  include <utility>
+
+#  include <dune/localfefunctions/expressionDescription.hh>
+#endif
+
+namespace Dune {
+
+  /** \brief The statistics of one node type of an expression tree for one derivative signature */
+  struct EvaluationProfileEntry {
+    /** \brief The expressionDescription() of the node type */
+    std::string node;
+    std::string signature;
+    bool isLeaf{};
+    /** \brief The number of requests of the value or derivative */
+    std::size_t calls{0};
+    /** \brief The number of requests, which were not served by the memoized results, see memoizedEvaluation() */
+    std::size_t evaluations{0};
+    /** \brief The accumulated wall time including the time spent in the subexpressions */
+    std::chrono::nanoseconds time{0};
+  };
+
+  /** \brief The statistics of all evaluations of local functions on this thread.
+   *
+   * It is only filled if DUNE_LOCALFEFUNCTIONS_ENABLE_PROFILING is set, otherwise the evaluations are not
+   * instrumented at all. */
+  class EvaluationProfile {
+  public:
+    const std::deque<EvaluationProfileEntry>& entries() const { return entries_; }
+
+    /** \brief Resets the statistics of all entries */
+    void reset() {
+      for (auto& entry : entries_) {
+        entry.calls       = 0;
+        entry.evaluations = 0;
+        entry.time        = std::chrono::nanoseconds(0);
+      }
+    }
+
+    void writeCSV(std::ostream& out) const {
+      out << "node,signature,isLeaf,calls,evaluations,timeInNanoseconds\n";
+      for (const auto& entry : entries_) {
+        if (entry.calls == 0) continue;
+        out << quoted(entry.node, '"') << ',' << quoted(entry.signature, '"') << ',' << entry.isLeaf << ','
+            << entry.calls << ',' << entry.evaluations << ',' << entry.time.count() << '\n';
+      }
+    }
+
+    void writeJSON(std::ostream& out) const {
+      out << "[";
+      bool first = true;
+      for (const auto& entry : entries_) {
+        if (entry.calls == 0) continue;
+        out << (first ? "\n" : ",\n") << "  {\"node\": " << quoted(entry.node, '\\')
+            << ", \"signature\": " << quoted(entry.signature, '\\') << ", \"isLeaf\": " << std::boolalpha
+            << entry.isLeaf << std::noboolalpha << ", \"calls\": " << entry.calls
+            << ", \"evaluations\": " << entry.evaluations << ", \"timeInNanoseconds\": " << entry.time.count() << "}";
+        first = false;
+      }
+      out << "\n]\n";
+    }
+
+    /** \brief Adds a new entry, the references to the entries stay valid */
+    EvaluationProfileEntry& add(std::string node, std::string signature, bool isLeaf) {
+      return entries_.emplace_back(EvaluationProfileEntry{std::move(node), std::move(signature), isLeaf});
+    }
+
+  private:
+    /* Quotes the string, where quotes are escaped by doubling them (CSV) or by a backslash (JSON) */
+    static std::string quoted(const std::string& str, char escape) {
+      std::string res = "\"";
+      for (char c : str) {
+        if (c == '"' or (escape == '\\' and c == '\\')) res += escape;
+        res += c;
+      }
+      return res + '"';
+    }
+
+    std::deque<EvaluationProfileEntry> entries_;
+  };
+
+  /** \brief The statistics of all evaluations of local functions on this thread, see EvaluationProfile */
+  inline EvaluationProfile& evaluationProfile() {
+    static thread_local EvaluationProfile profile;
+    return profile;
+  }
+
+#if DUNE_LOCALFEFUNCTIONS_ENABLE_PROFILING == 1
+  namespace Impl {
+    /* A readable description of the derivative directions of the evaluation, e.g. "d2/(dcoeff dcoeff) along" */
+    template <bool isValue, typename LFArgs>
+    std::string derivativeSignature() {
+      if constexpr (isValue) return "value";
+      using AlongArgs       = typename std::remove_cvref_t<decltype(std::declval<LFArgs>().alongArgs)>::Args;
+      const int order       = LFArgs::derivativeOrder;
+      std::string signature = "d" + (order > 1 ? std::to_string(order) : std::string()) + "/(";
+      if constexpr (LFArgs::hasOneSpatialSingle)
+        signature += "dspatial ";
+      else if constexpr (LFArgs::hasOneSpatialAll)
+        signature += "dspatialAll ";
+      if constexpr (LFArgs::hasSingleCoeff)
+        signature += "dcoeff ";
+      else if constexpr (LFArgs::hasTwoCoeff)
+        signature += "dcoeff dcoeff ";
+      signature.back() = ')';
+      if constexpr (std::tuple_size_v<AlongArgs> != 0) signature += " along";
+      return signature;
+    }
+
+    /* The entry of a node type and a derivative signature, which is registered at its first evaluation */
+    template <bool isValue, typename Node, typename LFArgs>
+    EvaluationProfileEntry& evaluationProfileEntry() {
+      static thread_local EvaluationProfileEntry& entry = evaluationProfile().add(
+          std::string(expressionDescription<Node>()), derivativeSignature<isValue, LFArgs>(), Node::isLeaf);
+      return entry;
+    }
+  }  // namespace Impl
+#endif
+
+  /** \brief Records the number of calls, the number of evaluations and the wall time of the evaluation of the node if
+   * DUNE_LOCALFEFUNCTIONS_ENABLE_PROFILING is set. The passed evaluate function takes a callback, which it has to call
+   * if the node is actually evaluated and not taken from a memo. */
+  template <bool isValue, typename Node, typename LFArgs, typename Evaluate>
+  auto profiledEvaluation(const Node&, const LFArgs&, Evaluate&& evaluate) {
+#if DUNE_LOCALFEFUNCTIONS_ENABLE_PROFILING == 1
+    auto& entry      = Impl::evaluationProfileEntry<isValue, Node, LFArgs>();
+    const auto start = std::chrono::steady_clock::now();
+    auto result      = evaluate([&]() { ++entry.evaluations; });
+    entry.time += std::chrono::steady_clock::now() - start;
+    ++entry.calls;
+    return result;
+#else
+    return evaluate([]() {});
+#endif
+  }
+
+}  // namespace Dune
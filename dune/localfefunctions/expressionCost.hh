@@ -0,0 +1,292 @@
+// SPDX-FileCopyrightText: 2022 The dune-localfefunction developers mueller@ibb.uni-stuttgart.de
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#pragma once
+
+#include <algorithm>
+#include <compare>
+#include <cstddef>
+#include <map>
+#include <string_view>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include <dune/localfefunctions/expressionDescription.hh>
+
+namespace Dune {
+
+  /** \brief A requested value or derivative of a node. The coefficient derivatives are zero (value), one (w.r.t. one
+   * coefficient) or two (w.r.t. two coefficients, contracted with an along argument) and spatialAll adds the
+   * derivative w.r.t. all spatial directions. */
+  struct CostSignature {
+    int coeffDerivatives{0};
+    bool spatialAll{false};
+
+    auto operator<=>(const CostSignature&) const = default;
+  };
+
+  /** \brief An analytic estimate of the floating point operations and of the bytes of the operands and the result */
+  struct EvaluationCost {
+    double flops{};
+    double bytes{};
+
+    EvaluationCost& operator+=(const EvaluationCost& other) {
+      flops += other.flops;
+      bytes += other.bytes;
+      return *this;
+    }
+
+    EvaluationCost& operator*=(double factor) {
+      flops *= factor;
+      bytes *= factor;
+      return *this;
+    }
+
+    friend EvaluationCost operator+(EvaluationCost a, const EvaluationCost& b) { return a += b; }
+    friend EvaluationCost operator*(double factor, EvaluationCost a) { return a *= factor; }
+
+    /** \brief The arithmetic intensity in FLOP per byte */
+    double arithmeticIntensity() const { return bytes > 0 ? flops / bytes : 0.0; }
+  };
+
+  /** \brief The sizes, which are not known from the type of a node */
+  struct CostContext {
+    int gridDim;
+    /** \brief The correction size of the coefficients w.r.t. which is differentiated */
+    int correctionSize;
+    int numberOfAnsatzFunctions;
+
+    /** \brief The number of doubles of the result of a node with the given value size */
+    double resultSize(int valueSize, const CostSignature& signature) const {
+      const double coeffPart = signature.coeffDerivatives == 0   ? valueSize
+                               : signature.coeffDerivatives == 1 ? valueSize * correctionSize
+                                                                 : correctionSize * correctionSize;
+      return coeffPart * (signature.spatialAll ? gridDim : 1);
+    }
+  };
+
+  /** \brief The signatures, which a node requests from each of its children, with the number of distinct requests */
+  using CostRequests = std::vector<std::pair<CostSignature, int>>;
+
+  namespace Impl {
+    enum class CostCategory { constant, leaf, projectionLeaf, linear, product, scalarFunction, kinematics, generic };
+
+    template <typename LF>
+    constexpr CostCategory costCategory() {
+      constexpr std::string_view kind = ExpressionKind<LF>::value;
+      if constexpr (kind == "Constant")
+        return CostCategory::constant;
+      else if constexpr (kind == "SLF")
+        return CostCategory::leaf;
+      else if constexpr (kind == "PBLF")
+        return CostCategory::projectionLeaf;
+      else if constexpr (kind == "Sum" or kind == "Scale" or kind == "Negate" or kind == "Trace"
+                         or kind == "LinearStrains" or kind == "DeformationGradient")
+        return CostCategory::linear;
+      else if constexpr (kind == "Dot" or kind == "NormSquared" or kind == "CrossProduct")
+        return CostCategory::product;
+      else if constexpr (kind == "GreenLagrangeStrains" or kind == "RightCauchyGreen" or kind == "Determinant")
+        return CostCategory::kinematics;
+      else if constexpr (LF::isLeaf)
+        return CostCategory::leaf;
+      else if constexpr (LF::children == 1 and ExpressionNode<LF>::valueSize == 1)
+        return CostCategory::scalarFunction;
+      else
+        return CostCategory::generic;
+    }
+
+    /* The binomial coefficient for n <= 2, which is the number of subsets of k coefficients of n */
+    constexpr int binomial(int n, int k) { return k == 0 or k == n ? 1 : n; }
+
+    /* The product rule needs all derivatives w.r.t. subsets of the requested directions */
+    inline CostRequests subsetRequests(const CostSignature& signature, bool spatialAll) {
+      CostRequests requests;
+      for (int k = 0; k <= signature.coeffDerivatives; ++k) {
+        requests.emplace_back(CostSignature{k, false}, binomial(signature.coeffDerivatives, k));
+        if (spatialAll) requests.emplace_back(CostSignature{k, true}, binomial(signature.coeffDerivatives, k));
+      }
+      return requests;
+    }
+
+    /* The number of terms of the product or chain rule */
+    inline double productRuleTerms(const CostSignature& signature) {
+      return static_cast<double>(1 << (signature.coeffDerivatives + (signature.spatialAll ? 1 : 0)));
+    }
+  }  // namespace Impl
+
+  /** \brief The cost model of one node of an expression tree, excluding the cost of its children.
+   *
+   * cost() estimates one evaluation of the node for the signature from the sizes of the node and its children, i.e.
+   * the operations on the results of the children and the bytes of these operands and of the result. requests() returns
+   * the signatures it needs from its children. The default covers the nodes of this module by their ExpressionKind:
+   * leaf nodes interpolate the coefficients, linear nodes pass the signature through, products and scalar functions
+   * apply the product or chain rule and the kinematic nodes request the spatial derivatives of the displacements. It
+   * can be specialized for new expressions.
+   */
+  template <typename LF>
+  struct ExpressionCostModel {
+    using Node                                   = ExpressionNode<LF>;
+    static constexpr Impl::CostCategory category = Impl::costCategory<LF>();
+
+    static EvaluationCost cost(const CostSignature& signature, const CostContext& context) {
+      using enum Impl::CostCategory;
+      const int n          = context.numberOfAnsatzFunctions;
+      const int d          = context.gridDim;
+      const int m          = Node::valueSize;
+      const double result  = context.resultSize(m, signature);
+      const double derived = signature.spatialAll ? d : 1;
+      if constexpr (category == constant)
+        return {};
+      else if constexpr (category == leaf or category == projectionLeaf) {
+        /* The value interpolates all coefficients, the derivatives w.r.t. a coefficient only scale the ansatz function.
+         * The spatial derivatives include the transformation of the ansatz function derivatives. */
+        EvaluationCost res;
+        if (signature.coeffDerivatives == 0) {
+          res.flops = 2.0 * n * m * derived + (signature.spatialAll ? 2.0 * n * d * d : 0.0);
+          res.bytes = 8.0 * (n * derived + n * m + result);
+        } else if (signature.coeffDerivatives == 1) {
+          res.flops = result;
+          res.bytes = 8.0 * (derived + result);
+        }
+        if constexpr (category == projectionLeaf) {
+          /* Normalization and projection onto the tangent space of the unit sphere */
+          res.flops += 3.0 * m + 2.0 * m * m * (signature.coeffDerivatives + 1) * derived;
+          res.bytes += 8.0 * m * m;
+        }
+        return res;
+      } else {
+        double operands = 0.0;
+        std::apply(
+            [&](auto... children) {
+              ((operands += context.resultSize(decltype(children)::valueSize, signature)), ...);
+            },
+            typename Node::Children());
+        EvaluationCost res{result, 8.0 * (operands + result)};
+        if constexpr (category == product or category == generic)
+          res.flops = 2.0 * Impl::productRuleTerms(signature) * std::max(operands, result);
+        else if constexpr (category == scalarFunction)
+          res.flops = 20.0 + Impl::productRuleTerms(signature) * operands;
+        else if constexpr (category == kinematics)
+          res.flops = 2.0 * Impl::productRuleTerms(signature) * d * result;
+        return res;
+      }
+    }
+
+    static CostRequests requests(const CostSignature& signature) {
+      using enum Impl::CostCategory;
+      constexpr std::string_view kind = Node::kind;
+      if constexpr (category == constant or category == leaf or category == projectionLeaf)
+        return {};
+      else if constexpr (kind == "LinearStrains" or kind == "DeformationGradient")
+        return {{CostSignature{signature.coeffDerivatives, true}, 1}};
+      else if constexpr (category == linear)
+        return {{signature, 1}};
+      else if constexpr (category == kinematics)
+        return Impl::subsetRequests({signature.coeffDerivatives, false}, true);
+      else
+        return Impl::subsetRequests(signature, signature.spatialAll);
+    }
+  };
+
+  /** \brief The evaluations of one node of an expression tree for one signature */
+  struct ExpressionCostEntry {
+    /** \brief The index of the node in the depth-first pre-order of forEachExpressionNode() */
+    std::size_t node;
+    std::string_view kind;
+    CostSignature signature;
+    /** \brief The number of distinct evaluations, e.g. w.r.t. both coefficients of a second derivative */
+    int evaluations;
+    /** \brief The cost of all evaluations */
+    EvaluationCost cost;
+  };
+
+  /** \brief The cost of one evaluation of an expression tree, split into its nodes */
+  struct ExpressionCost {
+    std::vector<ExpressionCostEntry> entries;
+
+    EvaluationCost total() const {
+      EvaluationCost res;
+      for (const auto& entry : entries)
+        res += entry.cost;
+      return res;
+    }
+  };
+
+  namespace Impl {
+    struct CostTable {
+      struct Value {
+        std::string_view kind;
+        int evaluations;
+        EvaluationCost cost;
+      };
+      std::map<std::pair<std::size_t, CostSignature>, Value> values;
+    };
+
+    template <typename LF>
+    constexpr std::size_t numberOfExpressionNodes() {
+      std::size_t size = 0;
+      forEachExpressionNode<LF>([&](auto) { ++size; });
+      return size;
+    }
+
+    /* Memoized subexpressions are evaluated once per requested signature and set of coefficients. Thus, a node, which
+     * is requested with the same signature by several parents, is counted with the largest number of requests. */
+    template <typename LF, std::size_t ID>
+    void collectCost(const CostSignature& signature, int evaluations, std::size_t node, const CostContext& context,
+                     CostTable& table) {
+      using Node  = ExpressionNode<LF>;
+      using Model = ExpressionCostModel<LF>;
+      if (signature.coeffDerivatives >= 1 and Node::template order<ID> == constant) return;
+      if (signature.coeffDerivatives == 2 and Node::template order<ID> <= linear) return;
+
+      auto [it, inserted] = table.values.try_emplace({node, signature}, CostTable::Value{Node::kind, 0, {}});
+      if (not inserted and it->second.evaluations >= evaluations) return;
+      it->second.evaluations = evaluations;
+      it->second.cost        = evaluations * Model::cost(signature, context);
+
+      for (const auto& [childSignature, multiplicity] : Model::requests(signature)) {
+        std::size_t child = node + 1;
+        std::apply(
+            [&](auto... children) {
+              ((collectCost<typename decltype(children)::Type, ID>(childSignature, evaluations * multiplicity, child,
+                                                                   context, table),
+                child += numberOfExpressionNodes<typename decltype(children)::Type>()),
+               ...);
+            },
+            typename Node::Children());
+      }
+    }
+  }  // namespace Impl
+
+  /** \brief Estimates the FLOPs and bytes of one evaluation of the local function with the given signature, where the
+   * coefficient derivatives are taken w.r.t. the leaf nodes with the given id.
+   *
+   * The cost of each node is given by ExpressionCostModel and summed over all nodes, which are evaluated, i.e. nodes
+   * with vanishing derivatives are skipped. The bytes include the intermediate results of the nodes, thus they are an
+   * upper bound of the memory traffic, which usually is served by the L1 cache. Together with a measured time, the
+   * total gives the achieved FLOP/s and the arithmetic intensity of a kernel, see attainableFlops(). */
+  template <typename LF, std::size_t ID = 0>
+  ExpressionCost expressionCost(const CostSignature& signature, int numberOfAnsatzFunctions) {
+    using LFRaw        = std::remove_cvref_t<LF>;
+    int correctionSize = 0;
+    forEachExpressionNode<LFRaw>([&](auto node) {
+      using Type = typename decltype(node)::Type;
+      if constexpr (Type::isLeaf and Type::id[0] == static_cast<int>(ID)) correctionSize = Type::correctionSize;
+    });
+    const CostContext context{LFRaw::gridDim, correctionSize, numberOfAnsatzFunctions};
+
+    Impl::CostTable table;
+    Impl::collectCost<LFRaw, ID>(signature, 1, 0, context, table);
+    ExpressionCost res;
+    for (const auto& [key, value] : table.values)
+      res.entries.push_back({key.first, value.kind, key.second, value.evaluations, value.cost});
+    return res;
+  }
+
+  /** \brief The attainable FLOP/s of the roofline model for the arithmetic intensity in FLOP per byte */
+  inline double attainableFlops(double arithmeticIntensity, double peakFlops, double peakBandwidth) {
+    return std::min(peakFlops, arithmeticIntensity * peakBandwidth);
+  }
+
+}  // namespace Dune
@@ -0,0 +1,218 @@
+// SPDX-FileCopyrightText: 2022 The dune-localfefunction developers mueller@ibb.uni-stuttgart.de
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+
+#include <dune/localfefunctions/meta.hh>
+
+namespace Dune {
+
+  template <typename E1, typename Func>
+  class ScalarUnaryExpr;
+
+  template <typename ValueFunction>
+  struct TaylorFunc;
+
+  namespace Impl {
+    /* The fully qualified name of T, taken from the signature of this function as printed by gcc and clang */
+    template <typename T>
+    constexpr std::string_view qualifiedTypeName() {
+      // gcc appends the other template parameters after "; ", clang closes the list with "]"
+      constexpr std::string_view signature = __PRETTY_FUNCTION__;
+      constexpr std::size_t start          = signature.find("T = ") + 4;
+      constexpr std::size_t end            = std::min(signature.find(';', start), signature.rfind(']'));
+      return signature.substr(start, end - start);
+    }
+
+    /* The name of T without namespaces and template arguments, e.g. SumExpr for Dune::SumExpr<A, B> */
+    template <typename T>
+    constexpr std::string_view unqualifiedTemplateName() {
+      std::string_view name = qualifiedTypeName<T>();
+      name                  = name.substr(0, name.find('<'));
+      if (const auto pos = name.rfind("::"); pos != std::string_view::npos) name.remove_prefix(pos + 2);
+      return name;
+    }
+
+    constexpr std::string_view removeSuffix(std::string_view name, std::string_view suffix) {
+      if (name.size() > suffix.size() and name.ends_with(suffix)) name.remove_suffix(suffix.size());
+      return name;
+    }
+
+    /* The abbreviations coincide with the ones of localFunctionName */
+    template <typename LF>
+    constexpr std::string_view defaultExpressionKind() {
+      constexpr std::string_view name = unqualifiedTemplateName<LF>();
+      if constexpr (name == "StandardLocalFunction")
+        return "SLF";
+      else if constexpr (name == "ProjectionBasedLocalFunction")
+        return "PBLF";
+      else if constexpr (name == "InnerProductExpr")
+        return "Dot";
+      else if constexpr (name == "LinearStrainExpr")
+        return "LinearStrains";
+      else
+        return removeSuffix(name, "Expr");
+    }
+
+    template <typename Func>
+    struct ScalarFunctionKind {
+      static constexpr std::string_view value = removeSuffix(unqualifiedTemplateName<Func>(), "Func");
+    };
+
+    /* User-defined functions are named by their functor, lambdas are called ScalarFunction */
+    template <typename ValueFunction>
+    struct ScalarFunctionKind<TaylorFunc<ValueFunction>> {
+      static constexpr bool isLambda = qualifiedTypeName<ValueFunction>().find("lambda") != std::string_view::npos;
+      static constexpr std::string_view value = isLambda ? "ScalarFunction" : unqualifiedTemplateName<ValueFunction>();
+    };
+  }  // namespace Impl
+
+  /** \brief The kind of an expression node, e.g. Sum or SLF. It can be specialized for new expressions, the default is
+   * the name of the class template without the suffix Expr. */
+  template <typename LF>
+  struct ExpressionKind {
+    static constexpr std::string_view value = Impl::defaultExpressionKind<LF>();
+  };
+
+  template <typename E1, typename Func>
+  struct ExpressionKind<ScalarUnaryExpr<E1, Func>> {
+    static constexpr std::string_view value = Impl::ScalarFunctionKind<Func>::value;
+  };
+
+  /** \brief The compile-time structure of a node of an expression tree
+   *
+   * Children is a std::tuple of the ExpressionNode of the subexpressions, such that the tree can be traversed without
+   * any object, see forEachExpressionNode(). */
+  template <typename LF>
+  struct ExpressionNode {
+    using Type                             = std::remove_cvref_t<LF>;
+    static constexpr std::string_view kind = ExpressionKind<Type>::value;
+    static constexpr bool isLeaf           = Type::isLeaf;
+    static constexpr int valueSize         = Type::Traits::valueSize;
+    static constexpr auto id               = Type::id;
+
+    /** \brief The order of the expression w.r.t. the coefficients of the leaf nodes with the given id */
+    template <std::size_t ID>
+    static constexpr int order = Type::template order<ID>();
+
+    /** \brief The sorted ids of all leaf nodes, which are not constants */
+    static constexpr auto leafIds = [] {
+      std::array<int, id.size()> ids{};
+      std::size_t size = 0;
+      for (int i : id)
+        if (i != arithmetic and std::find(ids.begin(), ids.begin() + size, i) == ids.begin() + size) ids[size++] = i;
+      std::sort(ids.begin(), ids.begin() + size);
+      return std::make_pair(ids, size);
+    }();
+
+  private:
+    static auto children() {
+      if constexpr (isLeaf)
+        return std::tuple<>();
+      else if constexpr (Type::children == 1)
+        return std::tuple<ExpressionNode<typename Type::E1Raw>>();
+      else
+        return std::tuple<ExpressionNode<typename Type::E1Raw>, ExpressionNode<typename Type::E2Raw>>();
+    }
+
+  public:
+    using Children = decltype(children());
+  };
+
+  /** \brief Calls f(ExpressionNode<X>()) for each node X of the expression tree of LF in depth-first pre-order */
+  template <typename LF, typename F>
+  constexpr void forEachExpressionNode(F&& f) {
+    using Node = ExpressionNode<LF>;
+    f(Node());
+    std::apply([&](auto... children) { (forEachExpressionNode<typename decltype(children)::Type>(f), ...); },
+               typename Node::Children());
+  }
+
+  namespace Impl {
+    constexpr std::string toString(int i) {
+      if (i < 0) return "-" + toString(-i);
+      std::string digits;
+      do {
+        digits.insert(digits.begin(), static_cast<char>('0' + i % 10));
+        i /= 10;
+      } while (i > 0);
+      return digits;
+    }
+
+    constexpr std::string orderName(int order) {
+      switch (order) {
+        case constant:
+          return "constant";
+        case linear:
+          return "linear";
+        case quadratic:
+          return "quadratic";
+        case cubic:
+          return "cubic";
+        case nonlinear:
+          return "nonlinear";
+        default:
+          return toString(order);
+      }
+    }
+
+    /* E.g. Sum<valueSize=2,order(0)=linear>(SLF<id=0,valueSize=2,order(0)=linear>,SLF<...>) */
+    template <typename LF>
+    constexpr std::string describe() {
+      using Node       = ExpressionNode<LF>;
+      std::string desc = std::string(Node::kind) + "<";
+      if constexpr (Node::isLeaf and Node::id[0] != arithmetic) desc += "id=" + toString(Node::id[0]) + ",";
+      desc += "valueSize=" + toString(Node::valueSize);
+      [&]<std::size_t... I>(std::index_sequence<I...>) {
+        constexpr auto& ids = Node::leafIds.first;
+        ((desc += ",order(" + toString(ids[I]) + ")=" + orderName(Node::template order<std::size_t(ids[I])>)), ...);
+      }(std::make_index_sequence<Node::leafIds.second>());
+      desc += ">";
+      if constexpr (not Node::isLeaf) {
+        desc += "(";
+        std::apply([&](auto... children) { ((desc += describe<typename decltype(children)::Type>() + ","), ...); },
+                   typename Node::Children());
+        desc.back() = ')';
+      }
+      return desc;
+    }
+
+    template <typename LF>
+    inline constexpr auto expressionDescriptionStorage = [] {
+      std::array<char, describe<LF>().size()> storage{};
+      const std::string desc = describe<LF>();
+      std::copy(desc.begin(), desc.end(), storage.begin());
+      return storage;
+    }();
+  }  // namespace Impl
+
+  /** \brief A description of the structure of the expression tree of LF, i.e. the kinds of the nodes, the ids of the
+   * leaf nodes, the value sizes, the orders w.r.t. the coefficients and the children. In contrast to
+   * localFunctionName(), it is created at compile-time and only depends on the type of the expression. */
+  template <typename LF>
+  constexpr std::string_view expressionDescription() {
+    const auto& storage = Impl::expressionDescriptionStorage<std::remove_cvref_t<LF>>;
+    return std::string_view(storage.data(), storage.size());
+  }
+
+  /** \brief A compile-time hash (FNV-1a) of the expression description, e.g. to be used as a key of caches */
+  template <typename LF>
+  constexpr std::uint64_t expressionHash() {
+    std::uint64_t hash = 14695981039346656037ULL;
+    for (char c : expressionDescription<LF>()) {
+      hash ^= static_cast<unsigned char>(c);
+      hash *= 1099511628211ULL;
+    }
+    return hash;
+  }
+
+}  // namespace Dune
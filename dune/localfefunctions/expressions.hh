@@ -3,13 +3,20 @@
 
 #pragma once
 
+#include "expressions/crossProductExpr.hh"
+#include "expressions/deformationGradientExpr.hh"
+#include "expressions/determinantExpr.hh"
 #include "expressions/dotProductExpr.hh"
 #include "expressions/greenLagrangeStrains.hh"
 #include "expressions/linearStrainsExpr.hh"
 #include "expressions/negateExpr.hh"
 #include "expressions/normSquaredExpr.hh"
+#include "expressions/rightCauchyGreenExpr.hh"
+#include "expressions/scalarunaryexpressions/scalarFunctionExpr.hh"
 #include "expressions/scalarunaryexpressions/scalarLogExpr.hh"
 #include "expressions/scalarunaryexpressions/scalarPowExpr.hh"
 #include "expressions/scalarunaryexpressions/scalarSqrtExpr.hh"
 #include "expressions/scaleExpr.hh"
 #include "expressions/sumExpr.hh"
+#include "expressions/traceExpr.hh"
+#include "expressions/vectorFunctionExpr.hh"
@@ -39,9 +39,17 @@ namespace Dune {
     template <size_t ID_ = 0>
     static constexpr int orderID = Op<E1, E2>::template orderID<ID_>;
 
+    /** Returns true if the operand i is stored by value and not by reference */
+    template <int i>
+    static constexpr bool ownsOperand = not std::is_reference_v<std::conditional_t<i == 0, E1, E2>>;
+
+    /* Owned leaf nodes of both operands with the same basis and geometry reuse each others transformed derivatives.
+     * Operands passed as lvalues are not changed. */
     constexpr BinaryExpr(E1&& u, E2&& v)
       requires IsLocalFunction<E1, E2>
-        : expr(std::forward<E1>(u), std::forward<E2>(v)) {}
+        : expr(std::forward<E1>(u), std::forward<E2>(v)) {
+      shareOwnedDerivativeTransformations<ownsOperand<0>, ownsOperand<1>>(expr.first, expr.second);
+    }
 
     static constexpr bool isLeaf  = false;
     static constexpr int children = 2;
@@ -0,0 +1,231 @@
+// SPDX-FileCopyrightText: 2022 The dune-localfefunction developers mueller@ibb.uni-stuttgart.de
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#pragma once
+#include "rebind.hh"
+
+#include <dune/localfefunctions/expressions/binaryExpr.hh>
+#include <dune/localfefunctions/linearAlgebraHelper.hh>
+namespace Dune {
+
+  /** \brief The cross product of two local functions with three components each.
+   *
+   * Derivatives are expressed with the skew-symmetric matrix S(a) with S(a) * b = a x b. Then for a vector a and a
+   * matrix B the columnwise cross products are a x B = S(a) B = leftMultiplyTranspose(S(a)^T, B) and
+   * B x a = leftMultiplyTranspose(S(a), B). */
+  template <typename E1, typename E2>
+  class CrossProductExpr : public BinaryExpr<CrossProductExpr, E1, E2> {
+  public:
+    using Base = BinaryExpr<CrossProductExpr, E1, E2>;
+    using Base::Base;
+    using Traits = LocalFunctionTraits<CrossProductExpr>;
+    /** \brief Type used for coordinates */
+    using ctype                    = typename Traits::ctype;
+    static constexpr int valueSize = Traits::valueSize;
+    static constexpr int gridDim   = Traits::gridDim;
+    using LinearAlgebra            = typename Base::E1Raw::LinearAlgebra;
+
+    static_assert(Base::E1Raw::valueSize == 3 and Base::E2Raw::valueSize == 3,
+                  "The cross product is only defined for functions with three components.");
+
+    template <size_t ID_ = 0>
+    static constexpr int orderID
+        = std::min(Base::E1Raw::template order<ID_>() + Base::E2Raw::template order<ID_>(), nonlinear);
+
+    template <typename LFArgs>
+    auto evaluateValueOfExpression(const LFArgs &lfArgs) const {
+      const auto u = evaluateFunctionImpl(this->l(), lfArgs);
+      const auto v = evaluateFunctionImpl(this->r(), lfArgs);
+      return cross(asVector(u), asVector(v));
+    }
+
+    template <int DerivativeOrder, typename LFArgs>
+    auto evaluateDerivativeOfExpression(const LFArgs &lfArgs) const {
+      const auto u = asVector(evaluateFunctionImpl(this->l(), lfArgs));
+      const auto v = asVector(evaluateFunctionImpl(this->r(), lfArgs));
+      if constexpr (DerivativeOrder == 1)  // d(u x v)/dx = u_x x v + u x v_x
+      {
+        const auto u_x = evaluateDerivativeImpl(this->l(), lfArgs);
+        const auto v_x = evaluateDerivativeImpl(this->r(), lfArgs);
+        return Dune::eval(leftMultiplyTranspose(skewMatrix(v), u_x)
+                          + leftMultiplyTranspose(transposeEvaluated(skewMatrix(u)), v_x));
+      } else if constexpr (DerivativeOrder == 2) {
+        // dd(u x v)/(dxdy) = u_{x,y} x v + u_x x v_y + u_y x v_x + u x v_{x,y}
+        const auto &[u_x, u_y] = evaluateFirstOrderDerivativesImpl(this->l(), lfArgs);
+        const auto &[v_x, v_y] = evaluateFirstOrderDerivativesImpl(this->r(), lfArgs);
+        if constexpr (LFArgs::hasNoSpatial and LFArgs::hasTwoCoeff) {
+          // lambda * (a x b) = a * (b x lambda)
+          const auto lambda       = asVector(std::get<0>(lfArgs.alongArgs.args));
+          const auto SLambda      = skewMatrix(lambda);
+          const auto vCrossLambda = cross(v, lambda);
+          const auto lambdaCrossu = cross(lambda, u);
+          const auto alonguArgs   = replaceAlong(lfArgs, along(vCrossLambda));
+          const auto alongvArgs   = replaceAlong(lfArgs, along(lambdaCrossu));
+
+          const auto u_xyAlongvCrossLambda = evaluateDerivativeImpl(this->l(), alonguArgs);
+          const auto v_xyAlongLambdaCrossu = evaluateDerivativeImpl(this->r(), alongvArgs);
+
+          return Dune::eval(u_xyAlongvCrossLambda + leftMultiplyTranspose(u_x, leftMultiplyTranspose(SLambda, v_y))
+                            + leftMultiplyTranspose(v_x, leftMultiplyTranspose(transposeEvaluated(SLambda), u_y))
+                            + v_xyAlongLambdaCrossu);
+        } else if constexpr (LFArgs::hasOneSpatial and LFArgs::hasSingleCoeff) {
+          const auto u_xy = evaluateDerivativeImpl(this->l(), lfArgs);
+          const auto v_xy = evaluateDerivativeImpl(this->r(), lfArgs);
+          const auto Sv   = skewMatrix(v);
+          const auto SuT  = transposeEvaluated(skewMatrix(u));
+          if constexpr (LFArgs::hasOneSpatialSingle and LFArgs::hasSingleCoeff) {
+            return Dune::eval(leftMultiplyTranspose(Sv, u_xy)
+                              + leftMultiplyTranspose(transposeEvaluated(skewMatrix(asVector(u_x))), v_y)
+                              + leftMultiplyTranspose(skewMatrix(asVector(v_x)), u_y)
+                              + leftMultiplyTranspose(SuT, v_xy));
+          } else if constexpr (LFArgs::hasOneSpatialAll and LFArgs::hasSingleCoeff) {
+            std::array<std::remove_cvref_t<decltype(Dune::eval(leftMultiplyTranspose(Sv, u_xy[0])))>, gridDim> res;
+            for (int i = 0; i < gridDim; ++i)
+              res[i] = Dune::eval(leftMultiplyTranspose(Sv, u_xy[i])
+                                  + leftMultiplyTranspose(transposeEvaluated(skewMatrix(col(u_x, i))), v_y)
+                                  + leftMultiplyTranspose(skewMatrix(col(v_x, i)), u_y)
+                                  + leftMultiplyTranspose(SuT, v_xy[i]));
+            return res;
+          }
+        }
+      } else if constexpr (DerivativeOrder == 3) {
+        // dd(u x v)/(dxdydz) = u_{x,y,z} x v + u_{x,y} x v_z + u_{x,z} x v_y + u_x x v_{y,z} + u_{y,z} x v_x
+        //                      + u_y x v_{x,z} + u_z x v_{x,y} + u x v_{x,y,z}
+        const auto argsForDyz = lfArgs.extractSecondWrtArgOrFirstNonSpatial();
+        if constexpr (LFArgs::hasOneSpatialSingle) {
+          const auto lambda   = asVector(std::get<0>(lfArgs.alongArgs.args));
+          const auto SLambda  = skewMatrix(lambda);
+          const auto SLambdaT = transposeEvaluated(SLambda);
+
+          const auto &[u_x, u_y, u_z] = evaluateFirstOrderDerivativesImpl(this->l(), lfArgs);
+          const auto &[v_x, v_y, v_z] = evaluateFirstOrderDerivativesImpl(this->r(), lfArgs);
+          const auto &[u_xy, u_xz]    = evaluateSecondOrderDerivativesImpl(this->l(), lfArgs);
+          const auto &[v_xy, v_xz]    = evaluateSecondOrderDerivativesImpl(this->r(), lfArgs);
+
+          const auto vCrossLambda     = cross(v, lambda);
+          const auto lambdaCrossu     = cross(lambda, u);
+          const auto v_xCrossLambda   = cross(asVector(v_x), lambda);
+          const auto lambdaCrossu_x   = cross(lambda, asVector(u_x));
+          const auto alonguArgs       = replaceAlong(lfArgs, along(vCrossLambda));
+          const auto alongvArgs       = replaceAlong(lfArgs, along(lambdaCrossu));
+          const auto argsForDyzAlongu = replaceAlong(argsForDyz, along(v_xCrossLambda));
+          const auto argsForDyzAlongv = replaceAlong(argsForDyz, along(lambdaCrossu_x));
+
+          const auto u_xyzAlongvCrossLambda  = evaluateDerivativeImpl(this->l(), alonguArgs);
+          const auto v_xyzAlongLambdaCrossu  = evaluateDerivativeImpl(this->r(), alongvArgs);
+          const auto u_yzAlongv_xCrossLambda = evaluateDerivativeImpl(this->l(), argsForDyzAlongu);
+          const auto v_yzAlongLambdaCrossu_x = evaluateDerivativeImpl(this->r(), argsForDyzAlongv);
+
+          return Dune::eval(u_xyzAlongvCrossLambda + leftMultiplyTranspose(u_xy, leftMultiplyTranspose(SLambda, v_z))
+                            + leftMultiplyTranspose(v_y, leftMultiplyTranspose(SLambdaT, u_xz))
+                            + v_yzAlongLambdaCrossu_x + u_yzAlongv_xCrossLambda
+                            + leftMultiplyTranspose(u_y, leftMultiplyTranspose(SLambda, v_xz))
+                            + leftMultiplyTranspose(v_xy, leftMultiplyTranspose(SLambdaT, u_z))
+                            + v_xyzAlongLambdaCrossu);
+        } else if constexpr (LFArgs::hasOneSpatialAll) {
+          // check that the along argument has the correct size
+          const auto &alongMatrix = std::get<0>(lfArgs.alongArgs.args);
+          using AlongMatrix       = std::remove_cvref_t<decltype(alongMatrix)>;
+          static_assert(Rows<AlongMatrix>::value == valueSize);
+          static_assert(Cols<AlongMatrix>::value == gridDim);
+
+          const auto &[gradu, u_c0, u_c1]  = evaluateFirstOrderDerivativesImpl(this->l(), lfArgs);
+          const auto &[gradv, v_c0, v_c1]  = evaluateFirstOrderDerivativesImpl(this->r(), lfArgs);
+          const auto &[gradu_c0, gradu_c1] = evaluateSecondOrderDerivativesImpl(this->l(), lfArgs);
+          const auto &[gradv_c0, gradv_c1] = evaluateSecondOrderDerivativesImpl(this->r(), lfArgs);
+
+          // the i-th columns are v x A_i and A_i x u, the vectors are the sums of A_i x u_{,i} and v_{,i} x A_i
+          typename LinearAlgebra::template FixedSizedMatrix<ctype, valueSize, gridDim> vCrossA, ACrossu;
+          auto ACrossGradu = createZeroVector<ctype, valueSize>();
+          auto gradvCrossA = createZeroVector<ctype, valueSize>();
+          for (int i = 0; i < gridDim; ++i) {
+            const auto A_i = asVector(col(alongMatrix, i));
+            const auto vCrossA_i = cross(v, A_i);
+            const auto A_iCrossu = cross(A_i, u);
+            for (int k = 0; k < valueSize; ++k) {
+              coeff(vCrossA, k, i) = vCrossA_i[k];
+              coeff(ACrossu, k, i) = A_iCrossu[k];
+            }
+            ACrossGradu += cross(A_i, asVector(col(gradu, i)));
+            gradvCrossA += cross(asVector(col(gradv, i)), A_i);
+          }
+
+          const auto alonguArgs       = replaceAlong(lfArgs, along(vCrossA));
+          const auto alongvArgs       = replaceAlong(lfArgs, along(ACrossu));
+          const auto argsForDyzAlongu = replaceAlong(argsForDyz, along(gradvCrossA));
+          const auto argsForDyzAlongv = replaceAlong(argsForDyz, along(ACrossGradu));
+
+          const auto u_xyzAlongvCrossA      = evaluateDerivativeImpl(this->l(), alonguArgs);
+          const auto v_xyzAlongACrossu      = evaluateDerivativeImpl(this->r(), alongvArgs);
+          const auto u_c0c1AlonggradvCrossA = evaluateDerivativeImpl(this->l(), argsForDyzAlongu);
+          const auto v_c0c1AlongACrossGradu = evaluateDerivativeImpl(this->r(), argsForDyzAlongv);
+          std::remove_cvref_t<decltype(eval(u_xyzAlongvCrossA))> res;
+
+          res = u_xyzAlongvCrossA + v_xyzAlongACrossu + u_c0c1AlonggradvCrossA + v_c0c1AlongACrossGradu;
+          for (int i = 0; i < gridDim; ++i) {
+            const auto SA_i  = skewMatrix(col(alongMatrix, i));
+            const auto SA_iT = transposeEvaluated(SA_i);
+            res += leftMultiplyTranspose(gradu_c0[i], leftMultiplyTranspose(SA_i, v_c1))
+                   + leftMultiplyTranspose(v_c0, leftMultiplyTranspose(SA_iT, gradu_c1[i]))
+                   + leftMultiplyTranspose(u_c0, leftMultiplyTranspose(SA_i, gradv_c1[i]))
+                   + leftMultiplyTranspose(gradv_c0[i], leftMultiplyTranspose(SA_iT, u_c1));
+          }
+
+          return res;
+        } else
+          static_assert(
+              LFArgs::hasOneSpatialSingle or LFArgs::hasOneSpatialAll,
+              "Only a spatial single direction or all spatial directions are supported. You should not end up here.");
+      } else
+        static_assert(DerivativeOrder > 3 or DerivativeOrder < 1,
+                      "Only first, second and third order derivatives are supported.");
+    }
+
+  private:
+    /* Copies a vector or a matrix with a single column into a vector, such that the cross helpers can be used */
+    template <typename VectorOrColumn>
+    static auto asVector(const VectorOrColumn &a) {
+      typename LinearAlgebra::template FixedSizedVector<ctype, valueSize> res;
+      for (int k = 0; k < valueSize; ++k)
+        res[k] = a[k];
+      return res;
+    }
+
+    /* The skew-symmetric matrix S(a) with S(a) * b = a x b */
+    template <typename Vector>
+    static auto skewMatrix(const Vector &a) {
+      typename LinearAlgebra::template FixedSizedMatrix<ctype, valueSize, valueSize> S;
+      setZero(S);
+      coeff(S, 0, 1) = -a[2];
+      coeff(S, 0, 2) = a[1];
+      coeff(S, 1, 0) = a[2];
+      coeff(S, 1, 2) = -a[0];
+      coeff(S, 2, 0) = -a[1];
+      coeff(S, 2, 1) = a[0];
+      return S;
+    }
+  };
+
+  template <typename E1, typename E2>
+  struct LocalFunctionTraits<CrossProductExpr<E1, E2>> {
+    using E1Raw = std::remove_cvref_t<E1>;
+    using E2Raw = std::remove_cvref_t<E2>;
+    /** \brief Size of the function value */
+    static constexpr int valueSize = 3;
+    /** \brief Type for the points for evaluation, usually the integration points */
+    using DomainType = std::common_type_t<typename E1Raw::DomainType, typename E2Raw::DomainType>;
+    /** \brief Type used for coordinates */
+    using ctype = std::common_type_t<typename E1Raw::ctype, typename E2Raw::ctype>;
+    /** \brief Dimension of the grid */
+    static constexpr int gridDim = E1Raw::gridDim;
+    /** \brief Dimension of the world where this function is mapped to from the reference element */
+    static constexpr int worldDimension = E1Raw::worldDimension;
+  };
+
+  template <typename E1, typename E2>
+    requires IsLocalFunction<E1, E2>
+  constexpr auto cross(E1 &&u, E2 &&v) {
+    return CrossProductExpr<E1, E2>(std::forward<E1>(u), std::forward<E2>(v));
+  }
+
+}  // namespace Dune
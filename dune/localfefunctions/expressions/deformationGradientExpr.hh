@@ -0,0 +1,126 @@
+// SPDX-FileCopyrightText: 2022 The dune-localfefunction developers mueller@ibb.uni-stuttgart.de
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#pragma once
+#include <dune/localfefunctions/expressions/expressionHelper.hh>
+#include <dune/localfefunctions/expressions/kinematicsHelper.hh>
+#include <dune/localfefunctions/expressions/rebind.hh>
+#include <dune/localfefunctions/expressions/unaryExpr.hh>
+#include <dune/localfefunctions/helper.hh>
+
+namespace Dune {
+
+  /** \brief The deformation gradient F = I + grad u of a displacement function u.
+   *
+   * The value is F stored column by column, i.e. the entry j * gridDim + i is F_ij. The columns are the tangent
+   * vectors g_j = X_{,j} + u_{,j} of the deformed configuration. For derivatives w.r.t. the reference element these are
+   * the convected base vectors. */
+  template <typename E1>
+  class DeformationGradientExpr : public UnaryExpr<DeformationGradientExpr, E1> {
+  public:
+    using Base = UnaryExpr<DeformationGradientExpr, E1>;
+    using Base::Base;
+    using Traits        = LocalFunctionTraits<DeformationGradientExpr>;
+    using LinearAlgebra = typename Base::E1Raw::LinearAlgebra;
+
+    /** \brief Type used for coordinates */
+    using ctype                           = typename Traits::ctype;
+    static constexpr int valueSize        = Traits::valueSize;
+    static constexpr int displacementSize = Base::E1Raw::valueSize;
+    static constexpr int gridDim          = Traits::gridDim;
+
+    static_assert(Base::E1Raw::template order<0>() == 1,
+                  "Deformation gradient expression only supported for linear displacement function w.r.t. "
+                  "coefficients.");
+    static_assert(displacementSize == gridDim,
+                  "Deformation gradient expression only supported if the displacements have the grid dimension.");
+
+    template <size_t ID_ = 0>
+    static constexpr int orderID = Base::E1Raw::template order<ID_>();
+
+    template <typename LFArgs>
+    auto evaluateValueOfExpression(const LFArgs& lfArgs) const {
+      const auto referenceJacobian = Impl::referenceJacobian<displacementSize>(this->m(), lfArgs);
+      const auto gradArgs          = replaceWrt(lfArgs, wrt(DerivativeDirections::spatialAll));
+      const auto gradu             = transposeEvaluated(evaluateDerivativeImpl(this->m(), gradArgs));
+      const auto g                 = Impl::deformationGradientRows<ctype, displacementSize>(referenceJacobian, gradu);
+
+      typename LinearAlgebra::template FixedSizedVector<ctype, valueSize> F;
+      for (int j = 0; j < gridDim; ++j)
+        for (int i = 0; i < displacementSize; ++i)
+          F[j * gridDim + i] = g[j][i];
+      return F;
+    }
+
+    template <int DerivativeOrder, typename LFArgs>
+    auto evaluateDerivativeOfExpression(const LFArgs& lfArgs) const {
+      if constexpr (DerivativeOrder == 1 and LFArgs::hasSingleCoeff) {
+        const auto gradArgsdI = addWrt(lfArgs, wrt(DerivativeDirections::spatialAll));
+        const auto dNI        = Impl::ansatzFunctionDerivatives<ctype, displacementSize>(
+            evaluateDerivativeImpl(this->m(), gradArgsdI));
+
+        // the derivative of F_ij w.r.t. the component a of the I-th coefficient is delta_ia * dN_I/dX_j
+        typename DefaultLinearAlgebra::template FixedSizedMatrix<ctype, valueSize, displacementSize> dFdI;
+        setZero(dFdI);
+        for (int j = 0; j < gridDim; ++j)
+          for (int i = 0; i < displacementSize; ++i)
+            coeff(dFdI, j * gridDim + i, i) = dNI[j];
+        return dFdI;
+      } else if constexpr (DerivativeOrder == 1 and LFArgs::hasOneSpatialAll) {
+        DUNE_THROW(Dune::NotImplemented, "Spatial derivatives of deformation gradient expression not implemented.");
+        return createZeroMatrix<ctype, valueSize, gridDim>();
+      } else if constexpr (DerivativeOrder == 1 and LFArgs::hasOneSpatialSingle) {
+        DUNE_THROW(Dune::NotImplemented, "Spatial derivatives of deformation gradient expression not implemented.");
+        return createZeroMatrix<ctype, valueSize, 1>();
+      } else if constexpr (DerivativeOrder == 2) {
+        if constexpr (LFArgs::hasNoSpatial and LFArgs::hasTwoCoeff) {
+          return createZeroMatrix<ctype, displacementSize, displacementSize>();
+        } else if constexpr (LFArgs::hasOneSpatial and LFArgs::hasSingleCoeff) {
+          if constexpr (LFArgs::hasOneSpatialSingle and LFArgs::hasSingleCoeff) {
+            DUNE_THROW(Dune::NotImplemented, "Spatial derivatives of deformation gradient expression not implemented.");
+            return createZeroMatrix<ctype, valueSize, displacementSize>();
+          } else if constexpr (LFArgs::hasOneSpatialAll and LFArgs::hasSingleCoeff) {
+            DUNE_THROW(Dune::NotImplemented, "Spatial derivatives of deformation gradient expression not implemented.");
+            return std::array<
+                typename DefaultLinearAlgebra::template FixedSizedMatrix<ctype, valueSize, displacementSize>,
+                gridDim>{};
+          }
+        }
+      } else if constexpr (DerivativeOrder == 3) {
+        DUNE_THROW(Dune::NotImplemented, "Spatial derivatives of deformation gradient expression not implemented.");
+        if constexpr (LFArgs::hasOneSpatialSingle) {
+          return createZeroMatrix<ctype, displacementSize, displacementSize>();
+        } else if constexpr (LFArgs::hasOneSpatialAll) {
+          return createZeroMatrix<ctype, displacementSize, displacementSize>();
+        } else
+          static_assert(
+              LFArgs::hasOneSpatialSingle or LFArgs::hasOneSpatialAll,
+              "Only a spatial single direction or all spatial directions are supported. You should not end up here.");
+      } else
+        static_assert(DerivativeOrder > 3 or DerivativeOrder < 1,
+                      "Only first, second and third order derivatives are supported.");
+    }
+  };
+
+  template <typename E1>
+  struct LocalFunctionTraits<DeformationGradientExpr<E1>> {
+    using E1Raw = std::remove_cvref_t<E1>;
+    /** \brief Size of the function value */
+    static constexpr int valueSize = E1Raw::valueSize * E1Raw::valueSize;
+    /** \brief Type for the points for evaluation, usually the integration points */
+    using DomainType = std::common_type_t<typename E1Raw::DomainType>;
+    /** \brief Type used for coordinates */
+    using ctype = std::common_type_t<typename E1Raw::ctype>;
+    /** \brief Dimension of the grid */
+    static constexpr int gridDim = E1Raw::gridDim;
+    /** \brief Dimension of the world where this function is mapped to from the reference element */
+    static constexpr int worldDimension = E1Raw::worldDimension;
+  };
+
+  template <typename E1>
+    requires IsLocalFunction<E1>
+  constexpr auto deformationGradient(E1&& u) {
+    return DeformationGradientExpr<E1>(std::forward<E1>(u));
+  }
+
+}  // namespace Dune
@@ -0,0 +1,172 @@
+// SPDX-FileCopyrightText: 2022 The dune-localfefunction developers mueller@ibb.uni-stuttgart.de
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#pragma once
+#include "rebind.hh"
+
+#include <dune/localfefunctions/expressions/expressionHelper.hh>
+#include <dune/localfefunctions/expressions/unaryExpr.hh>
+
+namespace Dune {
+
+  /** \brief The determinant of a square matrix valued local function, e.g. J = det(F) of a deformation gradient.
+   *
+   * The matrix is expected to be stored column by column as returned by deformationGradient(). */
+  template <typename E1>
+  class DeterminantExpr : public UnaryExpr<DeterminantExpr, E1> {
+  public:
+    using Base = UnaryExpr<DeterminantExpr, E1>;
+    using Base::Base;
+    using Traits        = LocalFunctionTraits<DeterminantExpr>;
+    using LinearAlgebra = typename Base::E1Raw::LinearAlgebra;
+    /** \brief Type used for coordinates */
+    using ctype                     = typename Traits::ctype;
+    static constexpr int valueSize  = 1;
+    static constexpr int gridDim    = Traits::gridDim;
+    static constexpr int matrixSize = Base::E1Raw::valueSize == 1 ? 1 : (Base::E1Raw::valueSize == 4 ? 2 : 3);
+
+    static_assert(matrixSize * matrixSize == Base::E1Raw::valueSize,
+                  "Determinant expression only defined for square matrices with up to three rows.");
+
+    template <size_t ID_ = 0>
+    static constexpr int orderID = std::min(matrixSize * Base::E1Raw::template order<ID_>(), nonlinear);
+
+    template <typename LFArgs>
+    auto evaluateValueOfExpression(const LFArgs &lfArgs) const {
+      const auto F = evaluateFunctionImpl(this->m(), lfArgs);
+      return typename DefaultLinearAlgebra::template FixedSizedMatrix<ctype, 1, 1>(determinant(F));
+    }
+
+    template <int DerivativeOrder, typename LFArgs>
+    auto evaluateDerivativeOfExpression(const LFArgs &lfArgs) const {
+      const auto F   = evaluateFunctionImpl(this->m(), lfArgs);
+      const auto cof = cofactors(F);
+      if constexpr (DerivativeOrder == 1)  // dJ/dx = cof(F) : F_x
+      {
+        const auto F_x = evaluateDerivativeImpl(this->m(), lfArgs);
+        return Dune::eval(leftMultiplyTranspose(cof, F_x));
+      } else if constexpr (DerivativeOrder == 2) {  // ddJ/(dxdy) = F_x : d^2J/dF^2 : F_y + cof(F) : F_{x,y}
+        const auto &[F_x, F_y] = evaluateFirstOrderDerivativesImpl(this->m(), lfArgs);
+        const auto HF_y        = Dune::eval(determinantHessian(F) * F_y);
+        if constexpr (LFArgs::hasNoSpatial and LFArgs::hasTwoCoeff) {
+          auto res = Dune::eval(leftMultiplyTranspose(F_x, HF_y));
+          if constexpr (not isZeroDerivative<E1, LFArgs>()) {
+            const auto alongCofArgs = replaceAlong(lfArgs, along(cof));
+            res += evaluateDerivativeImpl(this->m(), alongCofArgs);
+          }
+          return res;
+        } else if constexpr (LFArgs::hasOneSpatial and LFArgs::hasSingleCoeff) {
+          const auto F_xy = evaluateDerivativeImpl(this->m(), lfArgs);
+          if constexpr (LFArgs::hasOneSpatialSingle and LFArgs::hasSingleCoeff) {
+            return Dune::eval(leftMultiplyTranspose(F_x, HF_y) + leftMultiplyTranspose(cof, F_xy));
+          } else if constexpr (LFArgs::hasOneSpatialAll and LFArgs::hasSingleCoeff) {
+            std::array<std::remove_cvref_t<decltype(Dune::eval(leftMultiplyTranspose(cof, F_xy[0])))>, gridDim> res;
+            for (int i = 0; i < gridDim; ++i)
+              res[i] = leftMultiplyTranspose(col(F_x, i), HF_y) + leftMultiplyTranspose(cof, F_xy[i]);
+            return res;
+          }
+        }
+      } else if constexpr (DerivativeOrder == 3) {
+        DUNE_THROW(Dune::NotImplemented, "Third derivatives of determinant expression not implemented.");
+        using LeafNode            = std::remove_cvref_t<decltype(this->m().node())>;
+        constexpr int corrections = LeafNode::correctionSize;
+        if constexpr (LFArgs::hasOneSpatialSingle) {
+          return createZeroMatrix<ctype, corrections, corrections>();
+        } else if constexpr (LFArgs::hasOneSpatialAll) {
+          return createZeroMatrix<ctype, corrections, corrections>();
+        } else
+          static_assert(
+              LFArgs::hasOneSpatialSingle or LFArgs::hasOneSpatialAll,
+              "Only a spatial single direction or all spatial directions are supported. You should not end up here.");
+      } else
+        static_assert(DerivativeOrder > 3 or DerivativeOrder < 1,
+                      "Only first, second and third order derivatives are supported.");
+    }
+
+  private:
+    template <typename Matrix>
+    static ctype entry(const Matrix &F, int i, int j) {
+      return F[j * matrixSize + i];
+    }
+
+    template <typename Matrix>
+    static ctype determinant(const Matrix &F) {
+      if constexpr (matrixSize == 1)
+        return F[0];
+      else if constexpr (matrixSize == 2)
+        return entry(F, 0, 0) * entry(F, 1, 1) - entry(F, 0, 1) * entry(F, 1, 0);
+      else {
+        const auto cof = cofactors(F);
+        return entry(F, 0, 0) * cof[0] + entry(F, 0, 1) * cof[3] + entry(F, 0, 2) * cof[6];
+      }
+    }
+
+    /* The derivative of the determinant w.r.t. the matrix, i.e. the cofactor matrix, stored column by column */
+    template <typename Matrix>
+    static auto cofactors(const Matrix &F) {
+      typename DefaultLinearAlgebra::template FixedSizedVector<ctype, matrixSize * matrixSize> cof;
+      if constexpr (matrixSize == 1)
+        cof[0] = 1;
+      else if constexpr (matrixSize == 2) {
+        for (int j = 0; j < 2; ++j)
+          for (int i = 0; i < 2; ++i)
+            cof[j * 2 + i] = (i == j ? 1 : -1) * entry(F, 1 - i, 1 - j);
+      } else
+        for (int j = 0; j < 3; ++j)
+          for (int i = 0; i < 3; ++i) {
+            const int i1 = (i + 1) % 3, i2 = (i + 2) % 3, j1 = (j + 1) % 3, j2 = (j + 2) % 3;
+            cof[j * 3 + i] = entry(F, i1, j1) * entry(F, i2, j2) - entry(F, i1, j2) * entry(F, i2, j1);
+          }
+      return cof;
+    }
+
+    /* The second derivative of the determinant w.r.t. the matrix, i.e. d^2J/(dF_ij dF_kl) = e_ik e_jl in 2D and
+     * e_ikm e_jln F_mn in 3D with the permutation symbol e */
+    template <typename Matrix>
+    static auto determinantHessian(const Matrix &F) {
+      typename DefaultLinearAlgebra::template FixedSizedMatrix<ctype, matrixSize * matrixSize, matrixSize * matrixSize>
+          H;
+      setZero(H);
+      if constexpr (matrixSize == 2) {
+        constexpr auto e = [](int i, int j) { return i == j ? 0 : (i < j ? 1 : -1); };
+        for (int j = 0; j < 2; ++j)
+          for (int i = 0; i < 2; ++i)
+            for (int l = 0; l < 2; ++l)
+              for (int k = 0; k < 2; ++k)
+                coeff(H, j * 2 + i, l * 2 + k) = e(i, k) * e(j, l);
+      } else if constexpr (matrixSize == 3) {
+        constexpr auto e = [](int i, int j, int k) { return (i - j) * (j - k) * (k - i) / 2; };
+        for (int j = 0; j < 3; ++j)
+          for (int i = 0; i < 3; ++i)
+            for (int l = 0; l < 3; ++l)
+              for (int k = 0; k < 3; ++k)
+                for (int n = 0; n < 3; ++n)
+                  for (int m = 0; m < 3; ++m)
+                    coeff(H, j * 3 + i, l * 3 + k) += e(i, k, m) * e(j, l, n) * entry(F, m, n);
+      }
+      return H;
+    }
+  };
+
+  template <typename E1>
+  struct LocalFunctionTraits<DeterminantExpr<E1>> {
+    using E1Raw = std::remove_cvref_t<E1>;
+    /** \brief Size of the function value */
+    static constexpr int valueSize = 1;
+    /** \brief Type for the points for evaluation, usually the integration points */
+    using DomainType = std::common_type_t<typename E1Raw::DomainType>;
+    /** \brief Type used for coordinates */
+    using ctype = std::common_type_t<typename E1Raw::ctype>;
+    /** \brief Dimension of the grid */
+    static constexpr int gridDim = E1Raw::gridDim;
+    /** \brief Dimension of the world where this function is mapped to from the reference element */
+    static constexpr int worldDimension = E1Raw::worldDimension;
+  };
+
+  template <typename E1>
+    requires IsLocalFunction<E1>
+  constexpr auto det(E1 &&F) {
+    return DeterminantExpr<E1>(std::forward<E1>(F));
+  }
+
+}  // namespace Dune
@@ -1,6 +1,10 @@
 // SPDX-FileCopyrightText: 2022 The dune-localfefunction developers mueller@ibb.uni-stuttgart.de
 // SPDX-License-Identifier: LGPL-2.1-or-later
 
+#pragma once
+
+#include <dune/localfefunctions/meta.hh>
+
 namespace Dune {
 
   /** Helper to evaluate the local basis ansatz function and gradient with an integration point index or coordinate
@@ -16,4 +20,25 @@ namespace Dune {
                         or std::is_same_v<DomainTypeOrIntegrationPointIndex, int>,
                     "The argument you passed should be an id for the integration point or the point coordinates");
   }
+
+  /** \brief Returns true if the derivative of the local function w.r.t. the coefficients requested by the arguments
+   * vanishes. This is known at compile time from the order of the function w.r.t. the coefficients with the given id,
+   * i.e. if the function does not depend on the coefficients or if it is linear in them and differentiated twice. */
+  template <typename LF, typename LFArgs>
+  consteval bool isZeroDerivative() {
+    using namespace Dune::Indices;
+    using LFRaw = std::remove_cvref_t<LF>;
+    if constexpr (LFArgs::hasSingleCoeff) {
+      constexpr std::size_t I = std::remove_cvref_t<decltype(std::declval<LFArgs>().coeffsIndices[_0])>::value;
+      return LFRaw::template orderID<I> == constant;
+    } else if constexpr (LFArgs::hasTwoCoeff) {
+      constexpr std::size_t I = std::remove_cvref_t<decltype(std::declval<LFArgs>().coeffsIndices.first[_0])>::value;
+      constexpr std::size_t J = std::remove_cvref_t<decltype(std::declval<LFArgs>().coeffsIndices.second[_0])>::value;
+      if constexpr (I == J)
+        return LFRaw::template orderID<I> <= linear;
+      else
+        return LFRaw::template orderID<I> == constant or LFRaw::template orderID<J> == constant;
+    } else
+      return false;
+  }
 }  // namespace Dune
@@ -2,7 +2,10 @@
 // SPDX-License-Identifier: LGPL-2.1-or-later
 
 #pragma once
+#include <array>
+
 #include <dune/localfefunctions/expressions/expressionHelper.hh>
+#include <dune/localfefunctions/expressions/kinematicsHelper.hh>
 #include <dune/localfefunctions/expressions/rebind.hh>
 #include <dune/localfefunctions/expressions/unaryExpr.hh>
 #include <dune/localfefunctions/helper.hh>
@@ -27,20 +30,15 @@ namespace Dune {
                   "Linear strain expression only supported for linear displacement function w.r.t. coefficients.");
 
     template <size_t ID_ = 0>
-    static constexpr int orderID = 2;
+    static constexpr int orderID = std::min(2 * Base::E1Raw::template order<ID_>(), nonlinear);
 
     template <typename LFArgs>
     auto evaluateValueOfExpression(const LFArgs& lfArgs) const {
-      const auto integrationPointPosition
-          = returnIntegrationPointPosition(lfArgs.integrationPointOrIndex, this->m().basis());
-      auto referenceJacobian = maybeToEigen(this->m().geometry()->jacobianTransposed(integrationPointPosition));
+      const auto referenceJacobian = Impl::referenceJacobian<displacementSize>(this->m(), lfArgs);
       static_assert(std::is_same_v<typename decltype(referenceJacobian)::value_type, double>);
       const auto gradArgs = replaceWrt(lfArgs, wrt(DerivativeDirections::spatialAll));
       const auto gradu    = transposeEvaluated(evaluateDerivativeImpl(this->m(), gradArgs));
 
-      if constexpr (std::is_same_v<typename decltype(lfArgs.transformWithArgs)::T, DerivativeDirections::GridElement>)
-        referenceJacobian = createScaledIdentityMatrix<double, displacementSize, displacementSize>();
-
       typename LinearAlgebra::template FixedSizedVector<ctype, strainSize> E;
       // E= 1/2*(H^T * G + G^T * H + H^T * H) with H = gradu
       //         E=
@@ -68,51 +66,74 @@ namespace Dune {
       return E;
     }
 
+    /** \brief Writes the derivatives of the strains w.r.t. all coefficients of the leaf node with id ID and the
+     * geometric stiffness contribution, i.e. the second derivatives of the strains along the stresses S, into the
+     * passed matrices.
+     *
+     * The B-operator has to be sized strainSize x (n * displacementSize) and the geometric stiffness
+     * (n * displacementSize) x (n * displacementSize), where n is the number of ansatz functions. The displacement
+     * gradient and the spatial derivatives of all ansatz functions are evaluated once, whereas calling
+     * evaluateDerivative() for each pair of coefficients evaluates them again for every pair. The displacements have
+     * to be a leaf node, whose ansatz function derivatives are read directly. */
+    template <std::size_t ID = 0, typename DomainTypeOrIntegrationPointIndex, typename StressVector,
+              typename BOperator, typename GeometricStiffness, typename Transform = DerivativeDirections::GridElement,
+              typename TransformFunctor = Dune::DefaultFirstOrderTransformFunctor>
+    void evaluateBOperatorAndGeometricStiffness(const DomainTypeOrIntegrationPointIndex& ipIndexOrPosition,
+                                                const StressVector& S, BOperator& bop, GeometricStiffness& kg,
+                                                const On<Transform, TransformFunctor>& transform = {}) const {
+      static_assert(Rows<StressVector>::value == strainSize);
+      static_assert(Base::E1Raw::isLeaf and Base::E1Raw::id[0] == static_cast<int>(ID),
+                    "The B-operator is only implemented for displacements which are a leaf node with the given ID.");
+      using namespace Dune::DerivativeDirections;
+      const std::size_t numberOfNodes = this->m().basis().size();
+
+      startNewEvaluation();
+      const auto lfArgs = LocalFunctionEvaluationArgs(ipIndexOrPosition, wrt(spatialAll), along(), transform);
+
+      const auto referenceJacobian = Impl::referenceJacobian<displacementSize>(this->m(), lfArgs);
+      const auto gradu             = transposeEvaluated(evaluateDerivativeImpl(this->m(), lfArgs));
+      const auto g                 = Impl::deformationGradientRows<ctype, displacementSize>(referenceJacobian, gradu);
+
+      // The spatial derivatives of all ansatz functions are transformed only once and then read for each node
+      const auto& dNAll = this->m().evaluateAnsatzFunctionDerivatives(ipIndexOrPosition, transform);
+      auto dN           = [&](std::size_t I) {
+        std::array<ctype, displacementSize> dNI;
+        for (int d = 0; d < displacementSize; ++d)
+          dNI[d] = coeff(dNAll, I, d);
+        return dNI;
+      };
+      for (std::size_t I = 0; I < numberOfNodes; ++I) {
+        const auto bopI = bOperatorBlock(dN(I), g);
+        for (int r = 0; r < strainSize; ++r)
+          for (int c = 0; c < displacementSize; ++c)
+            coeff(bop, r, I * displacementSize + c) = coeff(bopI, r, c);
+      }
+
+      setZero(kg);
+      for (std::size_t I = 0; I < numberOfNodes; ++I)
+        for (std::size_t J = I; J < numberOfNodes; ++J) {
+          const ctype kgIJ = geometricStiffnessEntry(S, dN(I), dN(J));
+          for (int c = 0; c < displacementSize; ++c) {
+            coeff(kg, I * displacementSize + c, J * displacementSize + c) = kgIJ;
+            coeff(kg, J * displacementSize + c, I * displacementSize + c) = kgIJ;
+          }
+        }
+    }
+
     template <int DerivativeOrder, typename LFArgs>
     auto evaluateDerivativeOfExpression(const LFArgs& lfArgs) const {
       if constexpr (DerivativeOrder == 1 and LFArgs::hasSingleCoeff) {
-        const auto integrationPointPosition
-            = returnIntegrationPointPosition(lfArgs.integrationPointOrIndex, this->m().basis());
-        auto referenceJacobian = maybeToEigen(
-            this->m().geometry()->jacobianTransposed(integrationPointPosition));  // the rows are X_{,1} and X_{,2}
-        if constexpr (std::is_same_v<typename decltype(lfArgs.transformWithArgs)::T, DerivativeDirections::GridElement>)
-          referenceJacobian = createScaledIdentityMatrix<double, displacementSize, displacementSize>();
+        const auto referenceJacobian
+            = Impl::referenceJacobian<displacementSize>(this->m(), lfArgs);  // the rows are X_{,1} and X_{,2}
         const auto gradArgs = replaceWrt(lfArgs, wrt(DerivativeDirections::spatialAll));
         const auto gradu
             = transposeEvaluated(evaluateDerivativeImpl(this->m(), gradArgs));  // the rows are u_{,1} and u_{,2}
         const auto gradArgsdI = addWrt(lfArgs, wrt(DerivativeDirections::spatialAll));
         const auto gradUdI    = evaluateDerivativeImpl(this->m(), gradArgsdI);  // derivative of grad u wrt I-th coeff
 
-        typename LinearAlgebra::template FixedSizedMatrix<ctype, strainSize, gridDim> bopI{};
-        typename LinearAlgebra::template FixedSizedVector<ctype, gridDim> g1 = row(referenceJacobian, 0);
-        g1 += row(gradu, 0);
-        if constexpr (displacementSize == 1) {
-          coeff(bopI, 0, 0) = getDiagonalEntry(gradUdI[0], 0) * g1[0];
-        } else if constexpr (displacementSize == 2) {
-          typename DefaultLinearAlgebra::template FixedSizedVector<ctype, gridDim> g2 = row(referenceJacobian, 1);
-          g2 += row(gradu, 1);
-          const auto& dNIdT1 = getDiagonalEntry(gradUdI[0], 0);
-          const auto& dNIdT2 = getDiagonalEntry(gradUdI[1], 0);
-          row(bopI, 0)       = dNIdT1 * g1;                // dE11_dCIx,dE11_dCIy
-          row(bopI, 1)       = dNIdT2 * g2;                // dE22_dCIx,dE22_dCIy
-          row(bopI, 2)       = dNIdT2 * g1 + dNIdT1 * g2;  // 2*dE12_dCIx,2*dE12_dCIy
-        } else if constexpr (displacementSize == 3) {
-          typename DefaultLinearAlgebra::template FixedSizedVector<ctype, gridDim> g2 = row(referenceJacobian, 1);
-          g2 += row(gradu, 1);
-          typename DefaultLinearAlgebra::template FixedSizedVector<ctype, gridDim> g3 = row(referenceJacobian, 2);
-          g3 += row(gradu, 2);
-          const auto& dNIdT1 = getDiagonalEntry(gradUdI[0], 0);
-          const auto& dNIdT2 = getDiagonalEntry(gradUdI[1], 0);
-          const auto& dNIdT3 = getDiagonalEntry(gradUdI[2], 0);
-          row(bopI, 0)       = dNIdT1 * g1;                // dE11_dCIx,dE11_dCIy,dE11_dCIz
-          row(bopI, 1)       = dNIdT2 * g2;                // dE22_dCIx,dE22_dCIy,dE22_dCIz
-          row(bopI, 2)       = dNIdT3 * g3;                // dE33_dCIx,dE33_dCIy,dE33_dCIz
-          row(bopI, 3)       = dNIdT3 * g2 + dNIdT2 * g3;  // dE23_dCIx,dE23_dCIy,dE23_dCIz
-          row(bopI, 4)       = dNIdT3 * g1 + dNIdT1 * g3;  // dE13_dCIx,dE13_dCIy,dE13_dCIz
-          row(bopI, 5)       = dNIdT2 * g1 + dNIdT1 * g2;  // dE12_dCIx,dE12_dCIy,dE12_dCIz
-        }
-
-        return bopI;
+        const auto g   = Impl::deformationGradientRows<ctype, displacementSize>(referenceJacobian, gradu);
+        const auto dNI = Impl::ansatzFunctionDerivatives<ctype, displacementSize>(gradUdI);
+        return bOperatorBlock(dNI, g);
 
       } else if constexpr (DerivativeOrder == 1 and LFArgs::hasOneSpatialAll) {
         DUNE_THROW(Dune::NotImplemented, "Higher spatial derivatives of linear strain expression not implemented.");
@@ -129,31 +150,10 @@ namespace Dune {
 
           const auto gradArgsdIJ         = addWrt(lfArgs, wrt(DerivativeDirections::spatialAll));
           const auto& [gradUdI, gradUdJ] = evaluateSecondOrderDerivativesImpl(this->m(), gradArgsdIJ);
-          if constexpr (displacementSize == 1) {
-            const auto& dNIdT1 = getDiagonalEntry(gradUdI[0], 0);
-            const auto& dNJdT1 = getDiagonalEntry(gradUdJ[0], 0);
-            const ctype val    = S[0] * dNIdT1 * dNJdT1;
-            return createScaledIdentityMatrix<ctype, displacementSize, displacementSize>(val);
-          } else if constexpr (displacementSize == 2) {
-            const auto& dNIdT1 = getDiagonalEntry(gradUdI[0], 0);
-            const auto& dNIdT2 = getDiagonalEntry(gradUdI[1], 0);
-            const auto& dNJdT1 = getDiagonalEntry(gradUdJ[0], 0);
-            const auto& dNJdT2 = getDiagonalEntry(gradUdJ[1], 0);
-            const ctype val
-                = S[0] * dNIdT1 * dNJdT1 + S[1] * dNIdT2 * dNJdT2 + S[2] * (dNIdT1 * dNJdT2 + dNJdT1 * dNIdT2);
-            return createScaledIdentityMatrix<ctype, displacementSize, displacementSize>(val);
-          } else if constexpr (displacementSize == 3) {
-            const auto& dNIdT1 = getDiagonalEntry(gradUdI[0], 0);
-            const auto& dNIdT2 = getDiagonalEntry(gradUdI[1], 0);
-            const auto& dNIdT3 = getDiagonalEntry(gradUdI[2], 0);
-            const auto& dNJdT1 = getDiagonalEntry(gradUdJ[0], 0);
-            const auto& dNJdT2 = getDiagonalEntry(gradUdJ[1], 0);
-            const auto& dNJdT3 = getDiagonalEntry(gradUdJ[2], 0);
-            const ctype val    = S[0] * dNIdT1 * dNJdT1 + S[1] * dNIdT2 * dNJdT2 + S[2] * dNIdT3 * dNJdT3
-                              + S[3] * (dNIdT2 * dNJdT3 + dNJdT2 * dNIdT3) + S[4] * (dNIdT1 * dNJdT3 + dNJdT1 * dNIdT3)
-                              + S[5] * (dNIdT1 * dNJdT2 + dNJdT1 * dNIdT2);
-            return createScaledIdentityMatrix<ctype, displacementSize, displacementSize>(val);
-          }
+          const auto dNI                 = Impl::ansatzFunctionDerivatives<ctype, displacementSize>(gradUdI);
+          const auto dNJ                 = Impl::ansatzFunctionDerivatives<ctype, displacementSize>(gradUdJ);
+          const ctype val                = geometricStiffnessEntry(S, dNI, dNJ);
+          return createScaledIdentityMatrix<ctype, displacementSize, displacementSize>(val);
         } else if constexpr (LFArgs::hasOneSpatial and LFArgs::hasSingleCoeff) {
           if constexpr (LFArgs::hasOneSpatialSingle and LFArgs::hasSingleCoeff) {
             DUNE_THROW(Dune::NotImplemented, "Higher spatial derivatives of linear strain expression not implemented.");
@@ -179,6 +179,43 @@ namespace Dune {
         static_assert(DerivativeOrder > 3 or DerivativeOrder < 1,
                       "Only first, second and third order derivatives are supported.");
     }
+
+  private:
+    /* The derivatives of the strains in Voigt notation w.r.t. the I-th coefficient */
+    template <typename DeformationGradientRows>
+    static auto bOperatorBlock(const std::array<ctype, displacementSize>& dNI, const DeformationGradientRows& g) {
+      typename LinearAlgebra::template FixedSizedMatrix<ctype, strainSize, gridDim> bopI{};
+      if constexpr (displacementSize == 1) {
+        coeff(bopI, 0, 0) = dNI[0] * g[0][0];
+      } else if constexpr (displacementSize == 2) {
+        row(bopI, 0) = dNI[0] * g[0];                  // dE11_dCIx,dE11_dCIy
+        row(bopI, 1) = dNI[1] * g[1];                  // dE22_dCIx,dE22_dCIy
+        row(bopI, 2) = dNI[1] * g[0] + dNI[0] * g[1];  // 2*dE12_dCIx,2*dE12_dCIy
+      } else if constexpr (displacementSize == 3) {
+        row(bopI, 0) = dNI[0] * g[0];                  // dE11_dCIx,dE11_dCIy,dE11_dCIz
+        row(bopI, 1) = dNI[1] * g[1];                  // dE22_dCIx,dE22_dCIy,dE22_dCIz
+        row(bopI, 2) = dNI[2] * g[2];                  // dE33_dCIx,dE33_dCIy,dE33_dCIz
+        row(bopI, 3) = dNI[2] * g[1] + dNI[1] * g[2];  // dE23_dCIx,dE23_dCIy,dE23_dCIz
+        row(bopI, 4) = dNI[2] * g[0] + dNI[0] * g[2];  // dE13_dCIx,dE13_dCIy,dE13_dCIz
+        row(bopI, 5) = dNI[1] * g[0] + dNI[0] * g[1];  // dE12_dCIx,dE12_dCIy,dE12_dCIz
+      }
+      return bopI;
+    }
+
+    /* The second derivative of the strains along S w.r.t. the I-th and J-th coefficient is this value times the
+     * identity */
+    template <typename StressVector>
+    static ctype geometricStiffnessEntry(const StressVector& S, const std::array<ctype, displacementSize>& dNI,
+                                         const std::array<ctype, displacementSize>& dNJ) {
+      if constexpr (displacementSize == 1)
+        return S[0] * dNI[0] * dNJ[0];
+      else if constexpr (displacementSize == 2)
+        return S[0] * dNI[0] * dNJ[0] + S[1] * dNI[1] * dNJ[1] + S[2] * (dNI[0] * dNJ[1] + dNJ[0] * dNI[1]);
+      else
+        return S[0] * dNI[0] * dNJ[0] + S[1] * dNI[1] * dNJ[1] + S[2] * dNI[2] * dNJ[2]
+               + S[3] * (dNI[1] * dNJ[2] + dNJ[1] * dNI[2]) + S[4] * (dNI[0] * dNJ[2] + dNJ[0] * dNI[2])
+               + S[5] * (dNI[0] * dNJ[1] + dNJ[0] * dNI[1]);
+    }
   };
 
   template <typename E1>
@@ -0,0 +1,46 @@
+// SPDX-FileCopyrightText: 2022 The dune-localfefunction developers mueller@ibb.uni-stuttgart.de
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#pragma once
+#include <array>
+
+#include <dune/localfefunctions/eigenDuneTransformations.hh>
+#include <dune/localfefunctions/expressions/expressionHelper.hh>
+#include <dune/localfefunctions/linearAlgebraHelper.hh>
+
+namespace Dune::Impl {
+
+  /* The Jacobian of the reference configuration of the displacement function u, whose rows are X_{,1}, X_{,2} and
+   * X_{,3}. If the derivatives w.r.t. the grid element coordinates are requested, it is the identity. */
+  template <int size, typename LF, typename LFArgs>
+  auto referenceJacobian(const LF& u, const LFArgs& lfArgs) {
+    const auto integrationPointPosition = returnIntegrationPointPosition(lfArgs.integrationPointOrIndex, u.basis());
+    auto referenceJacobian = maybeToEigen(u.geometry()->jacobianTransposed(integrationPointPosition));
+    if constexpr (std::is_same_v<typename decltype(lfArgs.transformWithArgs)::T, DerivativeDirections::GridElement>)
+      referenceJacobian = createScaledIdentityMatrix<double, size, size>();
+    return referenceJacobian;
+  }
+
+  /* The rows g_i = X_{,i} + u_{,i} of the deformation gradient, i.e. the tangent vectors of the deformed
+   * configuration */
+  template <typename ctype, int size, typename ReferenceJacobian, typename DisplacementGradient>
+  auto deformationGradientRows(const ReferenceJacobian& referenceJacobian, const DisplacementGradient& gradu) {
+    std::array<typename DefaultLinearAlgebra::template FixedSizedVector<ctype, size>, size> g;
+    for (int i = 0; i < size; ++i) {
+      g[i] = row(referenceJacobian, i);
+      g[i] += row(gradu, i);
+    }
+    return g;
+  }
+
+  /* The spatial derivatives of the I-th ansatz function of a displacement function, which are stored on the diagonals
+   * of the derivatives of the displacement gradient w.r.t. the I-th coefficient */
+  template <typename ctype, int size, typename DisplacementGradientDerivatives>
+  auto ansatzFunctionDerivatives(const DisplacementGradientDerivatives& gradUdI) {
+    std::array<ctype, size> dNI;
+    for (int i = 0; i < size; ++i)
+      dNI[i] = getDiagonalEntry(gradUdI[i], 0);
+    return dNI;
+  }
+
+}  // namespace Dune::Impl
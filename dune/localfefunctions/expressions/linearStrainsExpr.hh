@@ -8,6 +8,10 @@
 #pragma once
 #include "rebind.hh"
 
+#include <memory>
+#include <span>
+
+#include <dune/localfefunctions/bOperatorCache.hh>
 #include <dune/localfefunctions/expressions/unaryExpr.hh>
 #include <dune/localfefunctions/helper.hh>
 
@@ -27,6 +31,9 @@ namespace Dune {
     static constexpr int displacementSize = Base::E1Raw::valueSize;
     static constexpr int gridDim          = Traits::gridDim;
 
+    /** \brief Type of the derivative of the strains w.r.t. a single coefficient */
+    using BOperator = typename DefaultLinearAlgebra::template FixedSizedMatrix<ctype, strainSize, gridDim>;
+
     static_assert(Base::E1Raw::template order<0>() == 1,
                   "Linear strain expression only supported for linear displacement function w.r.t. coefficients.");
 
@@ -45,10 +52,66 @@ namespace Dune {
       return EVoigt;
     }
 
+    /** \brief Computes the B-operators w.r.t. the coefficients of the leaf node with id ID at all integration points
+     * of the bound basis. Later derivatives w.r.t. single coefficients at integration point indices are served from
+     * them, as long as the geometry and the basis binding do not change.
+     *
+     * The strains are linear in the coefficients, thus the B-operators only depend on the geometry and the basis. The
+     * cache is opt-in, since it stores (number of integration points) x (number of ansatz functions) matrices.
+     *
+     * Each call fills a new cache, which is not modified afterwards. Thus, copies of this expression share the cache
+     * they were copied with, but binding a copy again never changes the cache of the others. */
+    template <std::size_t ID = 0, typename Transform = DerivativeDirections::GridElement,
+              typename TransformFunctor = Dune::DefaultFirstOrderTransformFunctor>
+    void bindBOperatorCache(const On<Transform, TransformFunctor> &transform = {}) {
+      static_assert(countNonArithmeticLeafNodes<typename Base::E1Raw>() == 1,
+                    "The B-operator cache is only supported for displacements with a single leaf node.");
+      bOperatorCache_.reset();  // the B-operators below are computed without the previous cache
+      auto bOperatorCache  = std::make_shared<BOperatorCache<BOperator>>();
+      const auto &leafNode = this->m().node();
+      const auto &basis    = leafNode.basis();
+      bOperatorCache->resize(basis.integrationPointSize(), basis.size());
+      for (std::size_t ipIndex = 0; ipIndex < basis.integrationPointSize(); ++ipIndex)
+        for (std::size_t i = 0; i < basis.size(); ++i)
+          (*bOperatorCache)(ipIndex, i)
+              = this->evaluateDerivative(ipIndex, wrt(coeff(Dune::index_constant<ID>(), i)), transform);
+      bOperatorCache->setBoundTo(leafNode.geometry(), basis, ID, transform);
+      bOperatorCache_ = std::move(bOperatorCache);
+    }
+
+    /** \brief Returns true if the derivatives w.r.t. the coefficients of the leaf node with id ID are served from the
+     * B-operator cache for the given transformation */
+    template <std::size_t ID = 0, typename Transform = DerivativeDirections::GridElement,
+              typename TransformFunctor = Dune::DefaultFirstOrderTransformFunctor>
+    bool usesBOperatorCache(const On<Transform, TransformFunctor> &transform = {}) const {
+      if constexpr (countNonArithmeticLeafNodes<typename Base::E1Raw>() != 1)
+        return false;
+      else {
+        const auto &leafNode = this->m().node();
+        return bOperatorCache_ and bOperatorCache_->isBoundTo(leafNode.geometry(), leafNode.basis(), ID, transform);
+      }
+    }
+
+    /** \brief Releases the B-operator cache, derivatives are computed on every call again */
+    void unbindBOperatorCache() { bOperatorCache_.reset(); }
+
+    /** \brief Returns the cached B-operators of all ansatz functions at the given integration point index. They are
+     * stored contiguously, e.g. to assemble the stiffness matrix blockwise. */
+    std::span<const BOperator> cachedBOperators(std::size_t ipIndex) const {
+      assert(bOperatorCache_ && "You have to call bindBOperatorCache first");
+      return bOperatorCache_->bOperatorsAt(ipIndex);
+    }
+
     template <int DerivativeOrder, typename LFArgs>
     auto evaluateDerivativeOfExpression(const LFArgs &lfArgs) const {
       if constexpr (DerivativeOrder == 1 and LFArgs::hasSingleCoeff) {
-        typename DefaultLinearAlgebra::template FixedSizedMatrix<ctype, strainSize, gridDim> bopI;
+        if constexpr (std::is_integral_v<std::remove_cvref_t<decltype(lfArgs.integrationPointOrIndex)>>) {
+          constexpr std::size_t leafNodeId
+              = std::remove_cvref_t<decltype(lfArgs.coeffsIndices[Dune::Indices::_0])>::value;
+          if (usesBOperatorCache<leafNodeId>(lfArgs.transformWithArgs))
+            return BOperator((*bOperatorCache_)(lfArgs.integrationPointOrIndex, lfArgs.coeffsIndices[1]));
+        }
+        BOperator bopI;
         const auto gradArgs = addWrt(lfArgs, wrt(DerivativeDirections::spatialAll));
         const auto gradUdI  = evaluateDerivativeImpl(this->m(), gradArgs);
         if constexpr (displacementSize == 1) {
@@ -114,6 +177,9 @@ namespace Dune {
         static_assert(DerivativeOrder > 3 or DerivativeOrder < 1,
                       "Only first, second and third order derivatives are supported.");
     }
+
+  private:
+    std::shared_ptr<const BOperatorCache<BOperator>> bOperatorCache_;
   };
 
   template <typename E1>
@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: LGPL-2.1-or-later
 
 #pragma once
+#include <dune/localfefunctions/expressions/expressionHelper.hh>
 #include <dune/localfefunctions/expressions/unaryExpr.hh>
 // #include <ikarus/utils/linearAlgebraHelper.hh>
 namespace Dune {
@@ -26,7 +27,10 @@ namespace Dune {
 
     template <int DerivativeOrder, typename LFArgs>
     auto evaluateDerivativeOfExpression(const LFArgs& lfArgs) const {
-      return Dune::eval(-evaluateDerivativeImpl(this->m(), lfArgs));
+      if constexpr (isZeroDerivative<E1, LFArgs>())
+        return DerivativeDirections::ZeroMatrix();
+      else
+        return Dune::eval(-evaluateDerivativeImpl(this->m(), lfArgs));
     }
   };
 
@@ -34,9 +38,29 @@ namespace Dune {
   struct LocalFunctionTraits<NegateExpr<E1>> : public LocalFunctionTraits<std::remove_cvref_t<E1>> {};
 
   template <typename E1>
-    requires IsLocalFunction<E1>
+    requires IsLocalFunction<E1> and (!(IsTemporary<E1> and (IsNegateExpr<E1> or IsScaleExpr<E1>)))
   constexpr auto operator-(E1&& u) {
     return NegateExpr<E1>(std::forward<E1>(u));
   }
 
+  /* Simplification -(-u) = u. If the inner negation only references u, the reference has to be kept and no
+   * simplification is possible */
+  template <typename E1>
+    requires IsNegateExpr<E1> and IsTemporary<E1>
+  constexpr auto operator-(E1&& u) {
+    using Operand = std::tuple_element_t<0, decltype(u.expr)>;
+    if constexpr (std::is_reference_v<Operand>)
+      return NegateExpr<E1>(std::forward<E1>(u));
+    else
+      return Operand(std::move(u.m()));
+  }
+
+  /* Simplification -(a*u) = (-a)*u */
+  template <typename E1>
+    requires IsScaleExpr<E1> and IsTemporary<E1>
+  constexpr auto operator-(E1&& u) {
+    u.l().value() *= -1;
+    return u;
+  }
+
 }  // namespace Dune
@@ -3,8 +3,11 @@
 
 #pragma once
 #include <cstddef>
+#include <optional>
 #include <tuple>
 
+#include <dune/localfefunctions/meta.hh>
+
 // #include <dune/localfefunctions/helper.hh>
 namespace Dune {
 
@@ -27,4 +30,79 @@ namespace Dune {
         u.rebindClone(OtherType(), std::forward<Dune::index_constant<ID>>(id)));
   }
 
+  /** \brief Sets the leaf nodes and constants of rebound, which is a rebindClone() of lf, to the current state of lf,
+   * see ClonableLocalFunction::assignRebound() */
+  template <typename ReboundLF, typename LF>
+  void assignRebound(ReboundLF& rebound, const LF& lf) {
+    using LFRaw = std::remove_cvref_t<LF>;
+    if constexpr (IsBinaryExpr<LFRaw>) {
+      assignRebound(rebound.l(), lf.l());
+      assignRebound(rebound.r(), lf.r());
+    } else if constexpr (IsUnaryExpr<LFRaw>)
+      assignRebound(rebound.m(), lf.m());
+    else if constexpr (IsArithmeticExpr<LFRaw>)
+      rebound.value() = lf.value();
+    else
+      rebound.assignRebound(lf);
+  }
+
+  /** \brief Returns a rebindClone() of lf, which is reused by later calls on the same thread with the same types.
+   *
+   * Only the first call creates the clone, later calls assign the coefficients of lf to it, see assignRebound(). Thus,
+   * e.g. differentiating with automatic differentiation element by element does not allocate and copy the bases and the
+   * coefficients each time. The returned reference stays valid, but is changed by the next call with the same types. */
+  template <typename LF, typename OtherType, std::size_t ID = 0>
+  auto& reusableRebindClone(const LF& lf, OtherType&&, Dune::index_constant<ID> = Dune::index_constant<0>()) {
+    using Rebound = std::remove_cvref_t<decltype(lf.rebindClone(OtherType(), Dune::index_constant<ID>()))>;
+    static thread_local std::optional<Rebound> rebound;
+    if (rebound)
+      assignRebound(*rebound, lf);
+    else
+      rebound.emplace(lf.rebindClone(OtherType(), Dune::index_constant<ID>()));
+    return *rebound;
+  }
+
+  namespace Impl {
+    /* Calls f with the coefficients of all leaf nodes of lf with the given id */
+    template <std::size_t ID, typename LF, typename F>
+    void forEachLeafNodeCoefficients(LF& lf, F&& f) {
+      using LFRaw = std::remove_cvref_t<LF>;
+      if constexpr (IsBinaryExpr<LFRaw>) {
+        forEachLeafNodeCoefficients<ID>(lf.l(), f);
+        forEachLeafNodeCoefficients<ID>(lf.r(), f);
+      } else if constexpr (IsUnaryExpr<LFRaw>)
+        forEachLeafNodeCoefficients<ID>(lf.m(), f);
+      else if constexpr (IsNonArithmeticLeafNode<LFRaw>)
+        if constexpr (LFRaw::id[0] == ID) f(lf.coefficientsRef());
+    }
+  }  // namespace Impl
+
+  /** \brief Returns a reusableRebindClone() of lf, where the coefficients of the leaf nodes with the given id are
+   * automatic differentiation numbers, e.g. VectorDual or ReverseScalar, which are seeded by seedInEmbedding().
+   *
+   * Thus, a single evaluation of the clone yields the derivatives w.r.t. all these coefficients, e.g. the gradient
+   * w.r.t. the coefficients is the gradient() of the value. Leaf nodes with the same id share the lanes. */
+  template <typename LF, typename OtherType, std::size_t ID = 0>
+  auto& seededRebindClone(const LF& lf, OtherType&&, Dune::index_constant<ID> id = Dune::index_constant<0>()) {
+    auto& rebound = reusableRebindClone(lf, OtherType(), id);
+    Impl::forEachLeafNodeCoefficients<ID>(rebound, [](auto& coeffs) { seedInEmbedding(coeffs); });
+    return rebound;
+  }
+
+  /** \brief Sets the forward mode derivatives of the coefficients of a seededRebindClone() with e.g.
+   * ReverseScalar<VectorDual<double, 1>> to the given direction in the embedding.
+   *
+   * Then, the forward mode derivatives of the gradient are the product of the Hessian w.r.t. the coefficients with the
+   * direction (forward-over-reverse), e.g. value.gradient()[k].derivative(0). */
+  template <typename ReboundLF, typename Direction, std::size_t ID = 0>
+  void seedDirectionInEmbedding(ReboundLF& rebound, const Direction& direction,
+                                Dune::index_constant<ID> = Dune::index_constant<0>()) {
+    Impl::forEachLeafNodeCoefficients<ID>(rebound, [&](auto& coeffs) {
+      constexpr int valueSize = std::remove_cvref_t<decltype(coeffs)>::value_type::valueSize;
+      for (std::size_t i = 0; i < coeffs.size(); ++i)
+        for (int j = 0; j < valueSize; ++j)
+          coeffs[i][j].value().gradient()[0] = direction[i * valueSize + j];
+    });
+  }
+
 }  // namespace Dune
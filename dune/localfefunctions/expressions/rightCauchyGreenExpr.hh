@@ -0,0 +1,157 @@
+// SPDX-FileCopyrightText: 2022 The dune-localfefunction developers mueller@ibb.uni-stuttgart.de
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#pragma once
+#include <array>
+
+#include <dune/localfefunctions/expressions/expressionHelper.hh>
+#include <dune/localfefunctions/expressions/kinematicsHelper.hh>
+#include <dune/localfefunctions/expressions/rebind.hh>
+#include <dune/localfefunctions/expressions/unaryExpr.hh>
+#include <dune/localfefunctions/helper.hh>
+
+namespace Dune {
+
+  /** \brief The right Cauchy-Green tensor C = F^T F of a displacement function u.
+   *
+   * The value is C in Voigt notation without factors, i.e. [C11, C22, C12] in 2D and [C11, C22, C33, C23, C13, C12] in
+   * 3D. The entries are C_ij = g_i * g_j with the tangent vectors g_i = X_{,i} + u_{,i} of the deformed
+   * configuration. */
+  template <typename E1>
+  class RightCauchyGreenExpr : public UnaryExpr<RightCauchyGreenExpr, E1> {
+  public:
+    using Base = UnaryExpr<RightCauchyGreenExpr, E1>;
+    using Base::Base;
+    using Traits        = LocalFunctionTraits<RightCauchyGreenExpr>;
+    using LinearAlgebra = typename Base::E1Raw::LinearAlgebra;
+
+    /** \brief Type used for coordinates */
+    using ctype                           = typename Traits::ctype;
+    static constexpr int strainSize       = Traits::valueSize;
+    static constexpr int displacementSize = Base::E1Raw::valueSize;
+    static constexpr int gridDim          = Traits::gridDim;
+
+    static_assert(Base::E1Raw::template order<0>() == 1,
+                  "Right Cauchy-Green expression only supported for linear displacement function w.r.t. coefficients.");
+
+    template <size_t ID_ = 0>
+    static constexpr int orderID = 2 * Base::E1Raw::template order<ID_>();
+
+    template <typename LFArgs>
+    auto evaluateValueOfExpression(const LFArgs& lfArgs) const {
+      const auto g = deformedTangentVectors(lfArgs);
+      typename LinearAlgebra::template FixedSizedVector<ctype, strainSize> C;
+      for (int k = 0; k < strainSize; ++k)
+        C[k] = inner(g[voigtIndices[k][0]], g[voigtIndices[k][1]]);
+      return C;
+    }
+
+    template <int DerivativeOrder, typename LFArgs>
+    auto evaluateDerivativeOfExpression(const LFArgs& lfArgs) const {
+      if constexpr (DerivativeOrder == 1 and LFArgs::hasSingleCoeff) {
+        const auto g          = deformedTangentVectors(lfArgs);
+        const auto gradArgsdI = addWrt(lfArgs, wrt(DerivativeDirections::spatialAll));
+        const auto dNI        = Impl::ansatzFunctionDerivatives<ctype, displacementSize>(
+            evaluateDerivativeImpl(this->m(), gradArgsdI));
+
+        // derivative of C_ij w.r.t. the I-th coefficient: dN_I/dX_i * g_j + dN_I/dX_j * g_i
+        typename DefaultLinearAlgebra::template FixedSizedMatrix<ctype, strainSize, displacementSize> dCdI;
+        for (int k = 0; k < strainSize; ++k) {
+          const auto [i, j] = voigtIndices[k];
+          row(dCdI, k)      = dNI[i] * g[j] + dNI[j] * g[i];
+        }
+        return dCdI;
+      } else if constexpr (DerivativeOrder == 1 and LFArgs::hasOneSpatialAll) {
+        DUNE_THROW(Dune::NotImplemented, "Spatial derivatives of right Cauchy-Green expression not implemented.");
+        return createZeroMatrix<ctype, strainSize, gridDim>();
+      } else if constexpr (DerivativeOrder == 1 and LFArgs::hasOneSpatialSingle) {
+        DUNE_THROW(Dune::NotImplemented, "Spatial derivatives of right Cauchy-Green expression not implemented.");
+        return createZeroMatrix<ctype, strainSize, 1>();
+      } else if constexpr (DerivativeOrder == 2) {
+        if constexpr (LFArgs::hasNoSpatial and LFArgs::hasTwoCoeff) {
+          const auto& S      = std::get<0>(lfArgs.alongArgs.args);
+          using StressVector = std::remove_cvref_t<decltype(S)>;
+
+          static_assert(Rows<StressVector>::value == strainSize);
+
+          const auto gradArgsdIJ         = addWrt(lfArgs, wrt(DerivativeDirections::spatialAll));
+          const auto& [gradUdI, gradUdJ] = evaluateSecondOrderDerivativesImpl(this->m(), gradArgsdIJ);
+          const auto dNI                 = Impl::ansatzFunctionDerivatives<ctype, displacementSize>(gradUdI);
+          const auto dNJ                 = Impl::ansatzFunctionDerivatives<ctype, displacementSize>(gradUdJ);
+
+          // the second derivative of C_ij w.r.t. the I-th and J-th coefficient is
+          // (dN_I/dX_i * dN_J/dX_j + dN_I/dX_j * dN_J/dX_i) times the identity
+          ctype val = 0;
+          for (int k = 0; k < strainSize; ++k) {
+            const auto [i, j] = voigtIndices[k];
+            val += S[k] * (dNI[i] * dNJ[j] + dNI[j] * dNJ[i]);
+          }
+          return createScaledIdentityMatrix<ctype, displacementSize, displacementSize>(val);
+        } else if constexpr (LFArgs::hasOneSpatial and LFArgs::hasSingleCoeff) {
+          if constexpr (LFArgs::hasOneSpatialSingle and LFArgs::hasSingleCoeff) {
+            DUNE_THROW(Dune::NotImplemented, "Spatial derivatives of right Cauchy-Green expression not implemented.");
+            return createZeroMatrix<ctype, strainSize, displacementSize>();
+          } else if constexpr (LFArgs::hasOneSpatialAll and LFArgs::hasSingleCoeff) {
+            DUNE_THROW(Dune::NotImplemented, "Spatial derivatives of right Cauchy-Green expression not implemented.");
+            return std::array<
+                typename DefaultLinearAlgebra::template FixedSizedMatrix<ctype, strainSize, displacementSize>,
+                gridDim>{};
+          }
+        }
+      } else if constexpr (DerivativeOrder == 3) {
+        DUNE_THROW(Dune::NotImplemented, "Spatial derivatives of right Cauchy-Green expression not implemented.");
+        if constexpr (LFArgs::hasOneSpatialSingle) {
+          return createZeroMatrix<ctype, displacementSize, displacementSize>();
+        } else if constexpr (LFArgs::hasOneSpatialAll) {
+          return createZeroMatrix<ctype, displacementSize, displacementSize>();
+        } else
+          static_assert(
+              LFArgs::hasOneSpatialSingle or LFArgs::hasOneSpatialAll,
+              "Only a spatial single direction or all spatial directions are supported. You should not end up here.");
+      } else
+        static_assert(DerivativeOrder > 3 or DerivativeOrder < 1,
+                      "Only first, second and third order derivatives are supported.");
+    }
+
+  private:
+    /* The index pairs (i,j) of the entries C_ij in Voigt notation */
+    static constexpr auto voigtIndices = []() {
+      if constexpr (displacementSize == 1)
+        return std::array<std::array<int, 2>, 1>{{{0, 0}}};
+      else if constexpr (displacementSize == 2)
+        return std::array<std::array<int, 2>, 3>{{{0, 0}, {1, 1}, {0, 1}}};
+      else
+        return std::array<std::array<int, 2>, 6>{{{0, 0}, {1, 1}, {2, 2}, {1, 2}, {0, 2}, {0, 1}}};
+    }();
+
+    template <typename LFArgs>
+    auto deformedTangentVectors(const LFArgs& lfArgs) const {
+      const auto referenceJacobian = Impl::referenceJacobian<displacementSize>(this->m(), lfArgs);
+      const auto gradArgs          = replaceWrt(lfArgs, wrt(DerivativeDirections::spatialAll));
+      const auto gradu             = transposeEvaluated(evaluateDerivativeImpl(this->m(), gradArgs));
+      return Impl::deformationGradientRows<ctype, displacementSize>(referenceJacobian, gradu);
+    }
+  };
+
+  template <typename E1>
+  struct LocalFunctionTraits<RightCauchyGreenExpr<E1>> {
+    using E1Raw = std::remove_cvref_t<E1>;
+    /** \brief Size of the function value */
+    static constexpr int valueSize = E1Raw::valueSize == 1 ? 1 : (E1Raw::valueSize == 2 ? 3 : 6);
+    /** \brief Type for the points for evaluation, usually the integration points */
+    using DomainType = std::common_type_t<typename E1Raw::DomainType>;
+    /** \brief Type used for coordinates */
+    using ctype = std::common_type_t<typename E1Raw::ctype>;
+    /** \brief Dimension of the grid */
+    static constexpr int gridDim = E1Raw::gridDim;
+    /** \brief Dimension of the world where this function is mapped to from the reference element */
+    static constexpr int worldDimension = E1Raw::worldDimension;
+  };
+
+  template <typename E1>
+    requires IsLocalFunction<E1>
+  constexpr auto rightCauchyGreen(E1&& u) {
+    return RightCauchyGreenExpr<E1>(std::forward<E1>(u));
+  }
+
+}  // namespace Dune
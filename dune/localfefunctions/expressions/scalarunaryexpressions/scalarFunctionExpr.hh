@@ -0,0 +1,141 @@
+// SPDX-FileCopyrightText: 2022 The dune-localfefunction developers mueller@ibb.uni-stuttgart.de
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#pragma once
+#include <array>
+
+#include <dune/common/hybridutilities.hh>
+
+#include <dune/localfefunctions/expressions/scalarunaryexpressions/scalarUnaryExpression.hh>
+#include <dune/localfefunctions/expressions/scalarunaryexpressions/taylorScalar.hh>
+
+namespace Dune {
+
+  /** \brief Functor for ScalarUnaryExpr, which derives the derivatives of a scalar function from its value only.
+   *
+   * The function is evaluated with a TaylorScalar, thus ValueFunction has to be a stateless generic callable, e.g. a
+   * lambda without captures, which only uses the arithmetic operators and unqualified calls of exp, log, sqrt, pow,
+   * sin, cos and tanh. */
+  template <typename ValueFunction>
+  struct TaylorFunc {
+    static_assert(std::is_empty_v<ValueFunction> and std::is_default_constructible_v<ValueFunction>,
+                  "The value function has to be stateless, e.g. a lambda without captures.");
+
+    template <typename ScalarType>
+    static ScalarType value(const ScalarType& v) {
+      return ValueFunction{}(v);
+    }
+
+    template <typename ScalarType>
+    static ScalarType derivative(const ScalarType& v) {
+      return taylorSeries(v).template derivative<1>();
+    }
+
+    template <typename ScalarType>
+    static ScalarType secondDerivative(const ScalarType& v) {
+      return taylorSeries(v).template derivative<2>();
+    }
+
+    template <typename ScalarType>
+    static ScalarType thirdDerivative(const ScalarType& v) {
+      return taylorSeries(v).template derivative<3>();
+    }
+
+    /** \brief The derivatives f', ..., f^(n) from a single evaluation of the Taylor series, see ScalarUnaryExpr */
+    template <int n, typename ScalarType>
+    static std::array<ScalarType, n> derivatives(const ScalarType& v) {
+      const auto series = taylorSeries(v);
+      std::array<ScalarType, n> res;
+      Dune::Hybrid::forEach(Dune::Hybrid::integralRange(Dune::index_constant<n>{}),
+                            [&](auto k) { res[k] = series.template derivative<decltype(k)::value + 1>(); });
+      return res;
+    }
+
+  private:
+    template <typename ScalarType>
+    static TaylorScalar<ScalarType> taylorSeries(const ScalarType& v) {
+      return ValueFunction{}(TaylorScalar<ScalarType>::variable(v));
+    }
+  };
+
+  /** \brief Applies a user-defined scalar function to a scalar valued local function, e.g.
+   * scalarFunction([](const auto& x) { return x * exp(x); }, dot(u, u)). The derivatives are generated from the
+   * function value, see TaylorFunc. */
+  template <typename ValueFunction, typename E1>
+    requires IsLocalFunction<E1>
+  constexpr auto scalarFunction(ValueFunction, E1&& u) {
+    static_assert(std::remove_cvref_t<E1>::valueSize == 1,
+                  "Scalar function expression only defined for scalar valued local functions.");
+    return ScalarUnaryExpr<E1, TaylorFunc<ValueFunction>>(std::forward<E1>(u));
+  }
+
+  namespace ScalarFunctions {
+    struct Exp {
+      template <typename T>
+      T operator()(const T& x) const {
+        using std::exp;
+        return exp(x);
+      }
+    };
+
+    struct Tanh {
+      template <typename T>
+      T operator()(const T& x) const {
+        using std::tanh;
+        return tanh(x);
+      }
+    };
+
+    /* log(1 + exp(x)), where the exponential is only evaluated for negative arguments to avoid overflows */
+    struct Softplus {
+      template <typename T>
+      T operator()(const T& x) const {
+        using std::exp;
+        using std::log;
+        if (x > 0) return x + log(1 + exp(-x));
+        return log(1 + exp(x));
+      }
+    };
+
+    /* sqrt(x^2 + epsilon^2) with epsilon = 10^-regularizationExponent */
+    template <int regularizationExponent>
+    struct SmoothAbs {
+      template <typename T>
+      T operator()(const T& x) const {
+        using std::sqrt;
+        constexpr double epsilon = [] {
+          double eps = 1;
+          for (int i = 0; i < regularizationExponent; ++i)
+            eps /= 10;
+          return eps;
+        }();
+        return sqrt(x * x + epsilon * epsilon);
+      }
+    };
+  }  // namespace ScalarFunctions
+
+  template <typename E1>
+    requires IsLocalFunction<E1>
+  constexpr auto exp(E1&& u) {
+    return scalarFunction(ScalarFunctions::Exp{}, std::forward<E1>(u));
+  }
+
+  template <typename E1>
+    requires IsLocalFunction<E1>
+  constexpr auto tanh(E1&& u) {
+    return scalarFunction(ScalarFunctions::Tanh{}, std::forward<E1>(u));
+  }
+
+  template <typename E1>
+    requires IsLocalFunction<E1>
+  constexpr auto softplus(E1&& u) {
+    return scalarFunction(ScalarFunctions::Softplus{}, std::forward<E1>(u));
+  }
+
+  /** \brief A smooth approximation sqrt(u^2 + epsilon^2) of |u| with epsilon = 10^-regularizationExponent */
+  template <int regularizationExponent = 8, typename E1>
+    requires IsLocalFunction<E1>
+  constexpr auto smoothAbs(E1&& u) {
+    return scalarFunction(ScalarFunctions::SmoothAbs<regularizationExponent>{}, std::forward<E1>(u));
+  }
+}  // namespace Dune
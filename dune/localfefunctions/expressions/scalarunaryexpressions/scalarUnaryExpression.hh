@@ -2,10 +2,29 @@
 // SPDX-License-Identifier: LGPL-2.1-or-later
 
 #pragma once
+#include <array>
+
 #include <dune/localfefunctions/expressions/unaryExpr.hh>
 
 namespace Dune {
 
+  namespace Impl {
+    /* The derivatives f', ..., f^(n) of the functor of a ScalarUnaryExpr at u. A functor which computes them together,
+     * e.g. TaylorFunc, provides a static derivatives<n>(u) */
+    template <int n, typename Func, typename ScalarType>
+    std::array<ScalarType, n> scalarFunctionDerivatives(const ScalarType& u) {
+      static_assert(n >= 1 and n <= 3, "Only derivatives up to third order are available.");
+      if constexpr (requires { Func::template derivatives<n>(u); })
+        return Func::template derivatives<n>(u);
+      else if constexpr (n == 1)
+        return {Func::derivative(u)};
+      else if constexpr (n == 2)
+        return {Func::derivative(u), Func::secondDerivative(u)};
+      else
+        return {Func::derivative(u), Func::secondDerivative(u), Func::thirdDerivative(u)};
+    }
+  }  // namespace Impl
+
   template <typename E1, typename Func>
   class ScalarUnaryExpr : public UnaryExpr<ScalarUnaryExpr, E1, Func> {
   public:
@@ -20,7 +39,7 @@ namespace Dune {
     using E1Raw = std::remove_cvref_t<E1>;
 
     template <size_t ID_ = 0>
-    static constexpr int orderID = nonlinear;
+    static constexpr int orderID = Base::E1Raw::template order<ID_>() == constant ? constant : nonlinear;
 
     template <typename LFArgs>
     auto evaluateValueOfExpression(const LFArgs& lfArgs) const {
@@ -30,23 +49,24 @@ namespace Dune {
 
     template <int DerivativeOrder, typename LFArgs>
     auto evaluateDerivativeOfExpression(const LFArgs& lfArgs) const {
-      const auto u = coeff(evaluateFunctionImpl(this->m(), lfArgs), 0, 0);
+      const auto u  = coeff(evaluateFunctionImpl(this->m(), lfArgs), 0, 0);
+      const auto df = Impl::scalarFunctionDerivatives<DerivativeOrder, Func>(u);
       if constexpr (DerivativeOrder == 1)  // d(f(u(x)))/(dx) =  u_x *D (f(u(x))
       {
         const auto u_x = evaluateDerivativeImpl(this->m(), lfArgs);
-        return Dune::eval(u_x * Func::derivative(u));
+        return Dune::eval(u_x * df[0]);
       } else if constexpr (DerivativeOrder == 2) {  // d^2(f(u(x,y)))/(dxdy) = - u_x*u_y* D^2 (f(u(x,y))+
                                                     // u_xy* D(f(u(x,y))
         const auto& [u_x, u_y]    = evaluateFirstOrderDerivativesImpl(this->m(), lfArgs);
         const auto u_xy           = evaluateDerivativeImpl(this->m(), lfArgs);
-        const auto u_yTimesfactor = Dune::eval(u_y * Func::secondDerivative(u));
+        const auto u_yTimesfactor = Dune::eval(u_y * df[1]);
         if constexpr (LFArgs::hasOneSpatialAll and LFArgs::hasSingleCoeff) {
           std::array<std::remove_cvref_t<decltype(Dune::eval(coeff(u_x, 0, 0) * u_y))>, gridDim> res;
           for (int i = 0; i < gridDim; ++i)
-            res[i] = Dune::eval(col(u_x, i)[0] * u_yTimesfactor + u_xy[i] * Func::derivative(u));
+            res[i] = Dune::eval(col(u_x, i)[0] * u_yTimesfactor + u_xy[i] * df[0]);
           return res;
         } else {  // one spatial and one coeff derivative
-          return Dune::eval(leftMultiplyTranspose(u_x, u_yTimesfactor) + u_xy * Func::derivative(u));
+          return Dune::eval(leftMultiplyTranspose(u_x, u_yTimesfactor) + u_xy * df[0]);
         }
       } else if constexpr (DerivativeOrder == 3) {  // d^3(f(u(x,y,z)))/(dxdydz) =(u_x*u_y*u_z)* D^3 (f(u(x,y,z)) +
                                                     // u_xz*u_y* D^2 (f(u(x,y,z)) + u_x*u_yz *D^2 (f(u(x,y,z)) +
@@ -63,22 +83,22 @@ namespace Dune {
           static_assert(Cols<decltype(u_x)>::value == 1);
           static_assert(Rows<decltype(u_x)>::value == 1);
 
-          return eval(u_xyz * Func::derivative(u)
-                      + (coeff(u_x, 0, 0) * leftMultiplyTranspose(u_y, u_z)) * Func::thirdDerivative(u)
+          return eval(u_xyz * df[0]
+                      + (coeff(u_x, 0, 0) * leftMultiplyTranspose(u_y, u_z)) * df[2]
                       + ((leftMultiplyTranspose(u_y, u_xz) + coeff(u_x, 0, 0) * transposeEvaluated(u_yz)
                           + leftMultiplyTranspose(u_xy, u_z)))
-                            * Func::secondDerivative(u));
+                            * df[1]);
         } else if constexpr (LFArgs::hasOneSpatialAll) {
           const auto& alongMatrix = std::get<0>(lfArgs.alongArgs.args);
           std::remove_cvref_t<decltype(u_xyz)> res;
-          res = u_xyz * Func::derivative(u);
+          res = u_xyz * df[0];
 
           for (int i = 0; i < gridDim; ++i)
             res += coeff(alongMatrix, 0, i)
-                   * (coeff(u_x, 0, i) * leftMultiplyTranspose(u_y, u_z) * Func::thirdDerivative(u)
+                   * (coeff(u_x, 0, i) * leftMultiplyTranspose(u_y, u_z) * df[2]
                       + (leftMultiplyTranspose(u_y, u_xz[i]) + coeff(u_x, 0, i) * transposeEvaluated(u_yz)
                          + leftMultiplyTranspose(u_xy[i], u_z))
-                            * Func::secondDerivative(u));
+                            * df[1]);
           return res;
         }
       }
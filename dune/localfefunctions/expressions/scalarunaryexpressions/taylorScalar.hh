@@ -0,0 +1,169 @@
+// SPDX-FileCopyrightText: 2022 The dune-localfefunction developers mueller@ibb.uni-stuttgart.de
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#pragma once
+#include <array>
+#include <cmath>
+#include <type_traits>
+
+namespace Dune {
+
+  /** \brief A Taylor series a_0 + a_1 h + a_2 h^2 + a_3 h^3 truncated after the third order term.
+   *
+   * Evaluating a scalar function with TaylorScalar<ScalarType>::variable(x) propagates the Taylor coefficients of
+   * f(x + h). Then the derivatives of f at x are f^(k)(x) = k! a_k, see derivative<k>(). The ScalarType can itself be
+   * an automatic differentiation type. */
+  template <typename ScalarType>
+  class TaylorScalar {
+  public:
+    static constexpr int order = 3;
+
+    TaylorScalar() : TaylorScalar(ScalarType(0)) {}
+
+    /** \brief Creates the Taylor series of a constant */
+    TaylorScalar(const ScalarType& val) : a_{val, ScalarType(0), ScalarType(0), ScalarType(0)} {}
+
+    /** \brief Creates the Taylor series of a constant number, e.g. of literals in the user-defined functions */
+    template <typename Number>
+      requires std::is_arithmetic_v<Number>
+    TaylorScalar(const Number& val) : TaylorScalar(ScalarType(val)) {}
+
+    /** \brief Creates the Taylor series of the independent variable at x */
+    static TaylorScalar variable(const ScalarType& x) {
+      TaylorScalar t(x);
+      t.a_[1] = ScalarType(1);
+      return t;
+    }
+
+    const ScalarType& operator[](int k) const { return a_[k]; }
+    ScalarType& operator[](int k) { return a_[k]; }
+
+    const ScalarType& value() const { return a_[0]; }
+
+    /** \brief The k-th derivative k! a_k of the function at the expansion point */
+    template <int k>
+    ScalarType derivative() const {
+      static_assert(k >= 0 and k <= order, "Only derivatives up to third order are available.");
+      constexpr int factorial = k == 3 ? 6 : (k == 2 ? 2 : 1);
+      return a_[k] * ScalarType(factorial);
+    }
+
+    /** \brief The Taylor series of g(a(h)) for an outer function g with the derivatives g0,...,g3 at a_0 */
+    TaylorScalar compose(const ScalarType& g0, const ScalarType& g1, const ScalarType& g2,
+                         const ScalarType& g3) const {
+      TaylorScalar res(g0);
+      res.a_[1] = g1 * a_[1];
+      res.a_[2] = g1 * a_[2] + g2 * a_[1] * a_[1] * ScalarType(0.5);
+      res.a_[3] = g1 * a_[3] + g2 * a_[1] * a_[2] + g3 * a_[1] * a_[1] * a_[1] / ScalarType(6);
+      return res;
+    }
+
+    TaylorScalar& operator+=(const TaylorScalar& b) {
+      for (int k = 0; k <= order; ++k)
+        a_[k] += b.a_[k];
+      return *this;
+    }
+
+    TaylorScalar& operator-=(const TaylorScalar& b) {
+      for (int k = 0; k <= order; ++k)
+        a_[k] -= b.a_[k];
+      return *this;
+    }
+
+    TaylorScalar& operator*=(const TaylorScalar& b) {
+      TaylorScalar res;
+      for (int k = 0; k <= order; ++k)
+        for (int i = 0; i <= k; ++i)
+          res.a_[k] += a_[i] * b.a_[k - i];
+      return *this = res;
+    }
+
+    TaylorScalar& operator/=(const TaylorScalar& b) {
+      TaylorScalar res;
+      for (int k = 0; k <= order; ++k) {
+        res.a_[k] = a_[k];
+        for (int j = 1; j <= k; ++j)
+          res.a_[k] -= b.a_[j] * res.a_[k - j];
+        res.a_[k] /= b.a_[0];
+      }
+      return *this = res;
+    }
+
+    TaylorScalar operator-() const {
+      TaylorScalar res(*this);
+      for (int k = 0; k <= order; ++k)
+        res.a_[k] = -res.a_[k];
+      return res;
+    }
+
+    friend TaylorScalar operator+(TaylorScalar a, const TaylorScalar& b) { return a += b; }
+    friend TaylorScalar operator-(TaylorScalar a, const TaylorScalar& b) { return a -= b; }
+    friend TaylorScalar operator*(TaylorScalar a, const TaylorScalar& b) { return a *= b; }
+    friend TaylorScalar operator/(TaylorScalar a, const TaylorScalar& b) { return a /= b; }
+
+    /* Comparisons only consider the value, such that branches in the user-defined functions can be evaluated */
+    friend bool operator<(const TaylorScalar& a, const TaylorScalar& b) { return a.value() < b.value(); }
+    friend bool operator>(const TaylorScalar& a, const TaylorScalar& b) { return a.value() > b.value(); }
+
+  private:
+    std::array<ScalarType, order + 1> a_;
+  };
+
+  template <typename ScalarType>
+  TaylorScalar<ScalarType> exp(const TaylorScalar<ScalarType>& a) {
+    using std::exp;
+    const ScalarType e = exp(a.value());
+    return a.compose(e, e, e, e);
+  }
+
+  template <typename ScalarType>
+  TaylorScalar<ScalarType> log(const TaylorScalar<ScalarType>& a) {
+    using std::log;
+    const ScalarType inv = ScalarType(1) / a.value();
+    return a.compose(log(a.value()), inv, -inv * inv, ScalarType(2) * inv * inv * inv);
+  }
+
+  template <typename ScalarType>
+  TaylorScalar<ScalarType> sqrt(const TaylorScalar<ScalarType>& a) {
+    using std::sqrt;
+    const ScalarType s   = sqrt(a.value());
+    const ScalarType inv = ScalarType(1) / a.value();
+    return a.compose(s, ScalarType(0.5) / s, ScalarType(-0.25) * inv / s, ScalarType(0.375) * inv * inv / s);
+  }
+
+  template <typename ScalarType, typename Number>
+    requires std::is_arithmetic_v<Number>
+  TaylorScalar<ScalarType> pow(const TaylorScalar<ScalarType>& a, const Number& p) {
+    using std::pow;
+    const ScalarType v = a.value();
+    const ScalarType q = ScalarType(p);
+    return a.compose(pow(v, q), q * pow(v, q - 1), q * (q - 1) * pow(v, q - 2), q * (q - 1) * (q - 2) * pow(v, q - 3));
+  }
+
+  template <typename ScalarType>
+  TaylorScalar<ScalarType> sin(const TaylorScalar<ScalarType>& a) {
+    using std::cos;
+    using std::sin;
+    const ScalarType s = sin(a.value());
+    const ScalarType c = cos(a.value());
+    return a.compose(s, c, -s, -c);
+  }
+
+  template <typename ScalarType>
+  TaylorScalar<ScalarType> cos(const TaylorScalar<ScalarType>& a) {
+    using std::cos;
+    using std::sin;
+    const ScalarType s = sin(a.value());
+    const ScalarType c = cos(a.value());
+    return a.compose(c, -s, -c, s);
+  }
+
+  template <typename ScalarType>
+  TaylorScalar<ScalarType> tanh(const TaylorScalar<ScalarType>& a) {
+    using std::tanh;
+    const ScalarType t  = tanh(a.value());
+    const ScalarType dt = ScalarType(1) - t * t;
+    return a.compose(t, dt, ScalarType(-2) * t * dt, (ScalarType(6) * t * t - ScalarType(2)) * dt);
+  }
+
+}  // namespace Dune
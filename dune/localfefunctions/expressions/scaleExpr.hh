@@ -4,6 +4,7 @@
 #pragma once
 #include <dune/localfefunctions/expressions/binaryExpr.hh>
 #include <dune/localfefunctions/expressions/constant.hh>
+#include <dune/localfefunctions/expressions/expressionHelper.hh>
 namespace Dune {
 
   template <typename E1, typename E2>
@@ -28,9 +29,13 @@ namespace Dune {
 
     template <int DerivativeOrder, typename LocalFunctionEvaluationArgs_>
     auto evaluateDerivativeOfExpression(const LocalFunctionEvaluationArgs_& localFunctionArgs) const {
-      auto res = Dune::eval(evaluateDerivativeImpl(this->r(), localFunctionArgs));
-      res *= this->l().value();
-      return res;
+      if constexpr (isZeroDerivative<E2, LocalFunctionEvaluationArgs_>())
+        return DerivativeDirections::ZeroMatrix();
+      else {
+        auto res = Dune::eval(evaluateDerivativeImpl(this->r(), localFunctionArgs));
+        res *= this->l().value();
+        return res;
+      }
     }
   };
 
@@ -38,7 +43,8 @@ namespace Dune {
   struct LocalFunctionTraits<ScaleExpr<E1, E2>> : public LocalFunctionTraits<std::remove_cvref_t<E2>> {};
 
   template <typename E1, typename E2>
-    requires(std::is_arithmetic_v<std::remove_cvref_t<E1>> and IsLocalFunction<E2> and !IsScaleExpr<E2>)
+    requires(std::is_arithmetic_v<std::remove_cvref_t<E1>> and IsLocalFunction<E2> and !IsScaleExpr<E2>
+             and !(IsNegateExpr<E2> and IsTemporary<E2>))
   constexpr ScaleExpr<ConstantExpr<E1, typename std::remove_cvref_t<E2>::LinearAlgebra>, E2> operator*(E1&& factor,
                                                                                                        E2&& u) {
     using LinearAlgebra = typename std::remove_cvref_t<E2>::LinearAlgebra;
@@ -66,6 +72,17 @@ namespace Dune {
     return operator*(std::forward<E1>(factor), std::forward<E2>(u));
   }
 
+  // Simplification a*(-u) = (-a)*u, the operand of the negation is taken over by the scale expression
+  template <typename E1, typename E2>
+    requires(std::is_arithmetic_v<std::remove_cvref_t<E1>> and IsNegateExpr<E2> and IsTemporary<E2>)
+  constexpr auto operator*(E1&& factor, E2&& u) {
+    using LinearAlgebra = typename std::remove_cvref_t<E2>::LinearAlgebra;
+    using Factor        = std::remove_cvref_t<E1>;
+    using Operand       = std::tuple_element_t<0, decltype(u.expr)>;
+    return ScaleExpr<ConstantExpr<Factor, LinearAlgebra>, Operand>(ConstantExpr<Factor, LinearAlgebra>(-factor),
+                                                                     std::forward<Operand>(u.m()));
+  }
+
   // Division operator
   template <typename E1, typename E2>
     requires(std::is_arithmetic_v<std::remove_cvref_t<E1>> and IsLocalFunction<E2> and !IsScaleExpr<E2>)
@@ -3,6 +3,7 @@
 
 #pragma once
 #include <dune/localfefunctions/expressions/binaryExpr.hh>
+#include <dune/localfefunctions/expressions/expressionHelper.hh>
 #include <dune/localfefunctions/expressions/rebind.hh>
 #include <dune/localfefunctions/linearAlgebraHelper.hh>
 
@@ -17,7 +18,7 @@ namespace Dune {
     using LinearAlgebra = typename Base::E1Raw::LinearAlgebra;
 
     template <size_t ID_ = 0>
-    static constexpr int orderID = std::max(Base::E1Raw::template order<ID_>(), Base::E1Raw::template order<ID_>());
+    static constexpr int orderID = std::max(Base::E1Raw::template order<ID_>(), Base::E2Raw::template order<ID_>());
 
     using ctype                    = typename Traits::ctype;
     static constexpr int valueSize = Traits::valueSize;
@@ -25,15 +26,35 @@ namespace Dune {
 
     template <typename LocalFunctionEvaluationArgs_>
     auto evaluateValueOfExpression(const LocalFunctionEvaluationArgs_& localFunctionArgs) const {
-      return Dune::eval(evaluateFunctionImpl(this->l(), localFunctionArgs)
-                        + evaluateFunctionImpl(this->r(), localFunctionArgs));
+      const auto u = evaluateFunctionImpl(this->l(), localFunctionArgs);
+      if constexpr (std::is_same_v<typename Base::E1Raw, typename Base::E2Raw>)
+        if (hasSameOperands()) return Dune::eval(u + u);
+      return Dune::eval(u + evaluateFunctionImpl(this->r(), localFunctionArgs));
     }
 
+    /* Operands whose derivative vanishes due to their order w.r.t. the coefficients are not evaluated */
     template <int DerivativeOrder, typename LocalFunctionEvaluationArgs_>
     auto evaluateDerivativeOfExpression(const LocalFunctionEvaluationArgs_& localFunctionArgs) const {
-      return Dune::eval(evaluateDerivativeImpl(this->l(), localFunctionArgs)
-                        + evaluateDerivativeImpl(this->r(), localFunctionArgs));
+      constexpr bool lIsZero = isZeroDerivative<E1, LocalFunctionEvaluationArgs_>();
+      constexpr bool rIsZero = isZeroDerivative<E2, LocalFunctionEvaluationArgs_>();
+      if constexpr (lIsZero and rIsZero)
+        return DerivativeDirections::ZeroMatrix();
+      else if constexpr (lIsZero)
+        return Dune::eval(evaluateDerivativeImpl(this->r(), localFunctionArgs));
+      else if constexpr (rIsZero)
+        return Dune::eval(evaluateDerivativeImpl(this->l(), localFunctionArgs));
+      else {
+        const auto du = evaluateDerivativeImpl(this->l(), localFunctionArgs);
+        if constexpr (std::is_same_v<typename Base::E1Raw, typename Base::E2Raw>)
+          if (hasSameOperands()) return Dune::eval(du + du);
+        return Dune::eval(du + evaluateDerivativeImpl(this->r(), localFunctionArgs));
+      }
     }
+
+  private:
+    /* u+u is evaluated as 2u, i.e. the operand is only evaluated once. This is only checked for operands of the same
+     * type, since otherwise u+u and u+v may differ in type, e.g. a diagonal and a dense derivative. */
+    bool hasSameOperands() const { return &this->l() == &this->r(); }
   };
 
   template <typename E1, typename E2>
@@ -0,0 +1,125 @@
+// SPDX-FileCopyrightText: 2022 The dune-localfefunction developers mueller@ibb.uni-stuttgart.de
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#pragma once
+#include "rebind.hh"
+
+#include <dune/localfefunctions/expressions/unaryExpr.hh>
+
+namespace Dune {
+
+  /** \brief The trace of a matrix valued local function, e.g. tr(C) of a right Cauchy-Green tensor.
+   *
+   * Square matrices are expected to be stored column by column as returned by deformationGradient(), symmetric matrices
+   * in Voigt notation as returned by rightCauchyGreen(). */
+  template <typename E1>
+  class TraceExpr : public UnaryExpr<TraceExpr, E1> {
+  public:
+    using Base = UnaryExpr<TraceExpr, E1>;
+    using Base::Base;
+    using Traits        = LocalFunctionTraits<TraceExpr>;
+    using LinearAlgebra = typename Base::E1Raw::LinearAlgebra;
+    /** \brief Type used for coordinates */
+    using ctype                    = typename Traits::ctype;
+    static constexpr int valueSize = 1;
+    static constexpr int gridDim   = Traits::gridDim;
+
+    template <size_t ID_ = 0>
+    static constexpr int orderID = Base::E1Raw::template order<ID_>();
+
+    template <typename LFArgs>
+    auto evaluateValueOfExpression(const LFArgs &lfArgs) const {
+      const auto m = evaluateFunctionImpl(this->m(), lfArgs);
+      return typename DefaultLinearAlgebra::template FixedSizedMatrix<ctype, 1, 1>(inner(diagonalIndicator(), m));
+    }
+
+    /* The trace is linear, thus each derivative is the trace of the derivative of the matrix. Derivatives along a
+     * direction are derivatives of the matrix along the diagonal scaled by the direction. */
+    template <int DerivativeOrder, typename LFArgs>
+    auto evaluateDerivativeOfExpression(const LFArgs &lfArgs) const {
+      const auto indicator = diagonalIndicator();
+      if constexpr (DerivativeOrder == 1) {
+        const auto m_x = evaluateDerivativeImpl(this->m(), lfArgs);
+        return Dune::eval(leftMultiplyTranspose(indicator, m_x));
+      } else if constexpr (DerivativeOrder == 2) {
+        if constexpr (LFArgs::hasNoSpatial and LFArgs::hasTwoCoeff) {
+          const auto alongIndicatorArgs = replaceAlong(lfArgs, along(indicator));
+          return Dune::eval(evaluateDerivativeImpl(this->m(), alongIndicatorArgs));
+        } else if constexpr (LFArgs::hasOneSpatial and LFArgs::hasSingleCoeff) {
+          const auto m_xy = evaluateDerivativeImpl(this->m(), lfArgs);
+          if constexpr (LFArgs::hasOneSpatialSingle and LFArgs::hasSingleCoeff) {
+            return Dune::eval(leftMultiplyTranspose(indicator, m_xy));
+          } else if constexpr (LFArgs::hasOneSpatialAll and LFArgs::hasSingleCoeff) {
+            std::array<std::remove_cvref_t<decltype(Dune::eval(leftMultiplyTranspose(indicator, m_xy[0])))>, gridDim>
+                res;
+            for (int i = 0; i < gridDim; ++i)
+              res[i] = leftMultiplyTranspose(indicator, m_xy[i]);
+            return res;
+          }
+        }
+      } else if constexpr (DerivativeOrder == 3) {
+        if constexpr (LFArgs::hasOneSpatialSingle) {
+          const auto alongIndicatorArgs = replaceAlong(lfArgs, along(indicator));
+          return Dune::eval(evaluateDerivativeImpl(this->m(), alongIndicatorArgs));
+        } else if constexpr (LFArgs::hasOneSpatialAll) {
+          const auto &alongMatrix = std::get<0>(lfArgs.alongArgs.args);
+          typename DefaultLinearAlgebra::template FixedSizedMatrix<ctype, Base::E1Raw::valueSize, gridDim>
+              indicatorTimesA;
+          for (int k = 0; k < Base::E1Raw::valueSize; ++k)
+            for (int i = 0; i < gridDim; ++i)
+              coeff(indicatorTimesA, k, i) = indicator[k] * coeff(alongMatrix, 0, i);
+          const auto alongIndicatorTimesAArgs = replaceAlong(lfArgs, along(indicatorTimesA));
+          return Dune::eval(evaluateDerivativeImpl(this->m(), alongIndicatorTimesAArgs));
+        } else
+          static_assert(
+              LFArgs::hasOneSpatialSingle or LFArgs::hasOneSpatialAll,
+              "Only a spatial single direction or all spatial directions are supported. You should not end up here.");
+      } else
+        static_assert(DerivativeOrder > 3 or DerivativeOrder < 1,
+                      "Only first, second and third order derivatives are supported.");
+    }
+
+  private:
+    /* The vector which is one for the diagonal entries of the matrix and zero otherwise. Square matrices with n^2
+     * entries are stored column by column, symmetric matrices with 3 or 6 entries in Voigt notation. */
+    static auto diagonalIndicator() {
+      constexpr int size = Base::E1Raw::valueSize;
+      static_assert(size == 1 or size == 3 or size == 4 or size == 6 or size == 9,
+                    "Trace expression only defined for 2x2 and 3x3 matrices.");
+      typename DefaultLinearAlgebra::template FixedSizedVector<ctype, size> indicator;
+      setZero(indicator);
+      if constexpr (size == 1 or size == 4 or size == 9) {
+        constexpr int rows = size == 1 ? 1 : (size == 4 ? 2 : 3);
+        for (int i = 0; i < rows; ++i)
+          indicator[i * rows + i] = 1;
+      } else {
+        constexpr int rows = size == 3 ? 2 : 3;
+        for (int i = 0; i < rows; ++i)
+          indicator[i] = 1;
+      }
+      return indicator;
+    }
+  };
+
+  template <typename E1>
+  struct LocalFunctionTraits<TraceExpr<E1>> {
+    using E1Raw = std::remove_cvref_t<E1>;
+    /** \brief Size of the function value */
+    static constexpr int valueSize = 1;
+    /** \brief Type for the points for evaluation, usually the integration points */
+    using DomainType = std::common_type_t<typename E1Raw::DomainType>;
+    /** \brief Type used for coordinates */
+    using ctype = std::common_type_t<typename E1Raw::ctype>;
+    /** \brief Dimension of the grid */
+    static constexpr int gridDim = E1Raw::gridDim;
+    /** \brief Dimension of the world where this function is mapped to from the reference element */
+    static constexpr int worldDimension = E1Raw::worldDimension;
+  };
+
+  template <typename E1>
+    requires IsLocalFunction<E1>
+  constexpr auto trace(E1 &&C) {
+    return TraceExpr<E1>(std::forward<E1>(C));
+  }
+
+}  // namespace Dune
@@ -26,6 +26,10 @@ namespace Dune {
 
     static constexpr auto id = E1Raw::id;
 
+    /** Returns true if the operand is stored by value and not by reference */
+    template <int i = 0>
+    static constexpr bool ownsOperand = not std::is_reference_v<E1>;
+
     auto clone() const { return Op<decltype(m().clone()), Args...>(m().clone()); }
 
     /** Rebind the value type of the underlying local function with the id ID */
@@ -0,0 +1,283 @@
+// SPDX-FileCopyrightText: 2022 The dune-localfefunction developers mueller@ibb.uni-stuttgart.de
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#pragma once
+#include "rebind.hh"
+
+#include <dune/localfefunctions/expressions/unaryExpr.hh>
+#include <dune/localfefunctions/linearAlgebraHelper.hh>
+#include <dune/localfefunctions/vectorDual.hh>
+
+namespace Dune {
+
+  /** \brief Applies a user-defined function F to the value u of a local function, e.g. a material law to the strains.
+   *
+   * Only F is differentiated with nested VectorDual numbers, which are local to the evaluation. The derivatives of u
+   * are the analytic ones of the inner expression and they are chained with the ones of F, i.e. for the along
+   * argument lambda, the spatial direction x and the coefficients y and z
+   *    h_y = J u_y,   h_xy = J u_xy + D(J)[u_x] u_y,
+   *    lambda h_yz = g u_yz + u_y^T H u_z,
+   *    lambda h_xyz = g u_xyz + (H u_x) u_yz + u_xy^T H u_z + u_y^T H u_xz + u_y^T D(H)[u_x] u_z,
+   * where J is the Jacobian of F, g = J^T lambda and H is the Hessian of lambda^T F. */
+  template <typename E1, typename ValueFunction>
+  class VectorFunctionExpr : public UnaryExpr<VectorFunctionExpr, E1, ValueFunction> {
+  public:
+    using Base = UnaryExpr<VectorFunctionExpr, E1, ValueFunction>;
+    using Base::Base;
+    using Traits = LocalFunctionTraits<VectorFunctionExpr>;
+    /** \brief Type used for coordinates */
+    using ctype                       = typename Traits::ctype;
+    static constexpr int valueSize    = Traits::valueSize;
+    static constexpr int gridDim      = Traits::gridDim;
+    static constexpr int argumentSize = Base::E1Raw::valueSize;
+    using LinearAlgebra               = typename Base::E1Raw::LinearAlgebra;
+
+    static_assert(std::is_empty_v<ValueFunction> and std::is_default_constructible_v<ValueFunction>,
+                  "The value function has to be stateless, e.g. a lambda without captures.");
+
+    template <size_t ID_ = 0>
+    static constexpr int orderID = Base::E1Raw::template order<ID_>() == constant ? constant : nonlinear;
+
+    template <typename LFArgs>
+    auto evaluateValueOfExpression(const LFArgs &lfArgs) const {
+      const auto u = evaluateFunctionImpl(this->m(), lfArgs);
+      const auto f = evaluateF<ctype>(u, [](const ctype &ui, int) { return ui; });
+      if constexpr (valueSize == 1)
+        return typename LinearAlgebra::template FixedSizedMatrix<ctype, 1, 1>(ctype(component(f, 0)));
+      else {
+        typename LinearAlgebra::template FixedSizedVector<ctype, valueSize> res;
+        for (int k = 0; k < valueSize; ++k)
+          res[k] = ctype(component(f, k));
+        return res;
+      }
+    }
+
+    template <int DerivativeOrder, typename LFArgs>
+    auto evaluateDerivativeOfExpression(const LFArgs &lfArgs) const {
+      const auto u = evaluateFunctionImpl(this->m(), lfArgs);
+      if constexpr (DerivativeOrder == 1)  // h_x = J u_x
+      {
+        const auto u_x = evaluateDerivativeImpl(this->m(), lfArgs);
+        return Dune::eval(leftMultiplyTranspose(transposedJacobian(u), u_x));
+      } else if constexpr (DerivativeOrder == 2) {
+        const auto &[u_x, u_y] = evaluateFirstOrderDerivativesImpl(this->m(), lfArgs);
+        if constexpr (LFArgs::hasNoSpatial and LFArgs::hasTwoCoeff) {  // lambda h_xy = g u_xy + u_x^T H u_y
+          const auto [g, H, DH] = contractedDerivatives<false>(u, alongArgument(lfArgs), u);
+          const auto u_xyAlongg = evaluateDerivativeImpl(this->m(), replaceAlong(lfArgs, along(g)));
+          return Dune::eval(u_xyAlongg + leftMultiplyTranspose(u_x, leftMultiplyTranspose(H, u_y)));
+        } else if constexpr (LFArgs::hasOneSpatial and LFArgs::hasSingleCoeff) {  // h_xy = J u_xy + D(J)[u_x] u_y
+          const auto u_xy = evaluateDerivativeImpl(this->m(), lfArgs);
+          if constexpr (LFArgs::hasOneSpatialSingle) {
+            const auto [JT, DJT] = transposedJacobianAndDirectionalDerivative(u, u_x, 0);
+            return Dune::eval(leftMultiplyTranspose(JT, u_xy) + leftMultiplyTranspose(DJT, u_y));
+          } else if constexpr (LFArgs::hasOneSpatialAll) {
+            std::array<std::remove_cvref_t<decltype(Dune::eval(leftMultiplyTranspose(DJTType(), u_y)))>, gridDim> res;
+            for (int i = 0; i < gridDim; ++i) {
+              const auto [JT, DJT] = transposedJacobianAndDirectionalDerivative(u, u_x, i);
+              res[i]               = Dune::eval(leftMultiplyTranspose(JT, u_xy[i]) + leftMultiplyTranspose(DJT, u_y));
+            }
+            return res;
+          }
+        }
+      } else if constexpr (DerivativeOrder == 3) {
+        const auto argsForDyz = lfArgs.extractSecondWrtArgOrFirstNonSpatial();
+        if constexpr (LFArgs::hasOneSpatialSingle) {
+          // lambda h_xyz = g u_xyz + (H u_x) u_yz + u_xy^T H u_z + u_y^T H u_xz + u_y^T D(H)[u_x] u_z
+          const auto &[u_x, u_y, u_z] = evaluateFirstOrderDerivativesImpl(this->m(), lfArgs);
+          const auto &[u_xy, u_xz]    = evaluateSecondOrderDerivativesImpl(this->m(), lfArgs);
+
+          const auto [g, H, DH] = contractedDerivatives<true>(u, alongArgument(lfArgs), u_x);
+          const auto Hu_x       = Dune::eval(leftMultiplyTranspose(H, u_x));
+
+          const auto u_xyzAlongg   = evaluateDerivativeImpl(this->m(), replaceAlong(lfArgs, along(g)));
+          const auto u_yzAlongHu_x = evaluateDerivativeImpl(this->m(), replaceAlong(argsForDyz, along(Hu_x)));
+
+          const auto Hu_z = Dune::eval(leftMultiplyTranspose(H, u_z));
+          return Dune::eval(u_xyzAlongg + u_yzAlongHu_x + leftMultiplyTranspose(u_xy, Hu_z)
+                            + leftMultiplyTranspose(u_y, leftMultiplyTranspose(H, u_xz))
+                            + leftMultiplyTranspose(u_y, leftMultiplyTranspose(DH, u_z)));
+        } else if constexpr (LFArgs::hasOneSpatialAll) {
+          // The spatial derivatives are summed up with the columns A_i of the along matrix as lambda
+          const auto &alongMatrix = std::get<0>(lfArgs.alongArgs.args);
+          using AlongMatrix       = std::remove_cvref_t<decltype(alongMatrix)>;
+          static_assert(Rows<AlongMatrix>::value == valueSize);
+          static_assert(Cols<AlongMatrix>::value == gridDim);
+
+          const auto &[gradu, u_c0, u_c1]  = evaluateFirstOrderDerivativesImpl(this->m(), lfArgs);
+          const auto &[gradu_c0, gradu_c1] = evaluateSecondOrderDerivativesImpl(this->m(), lfArgs);
+
+          typename LinearAlgebra::template FixedSizedMatrix<ctype, argumentSize, gridDim> G;
+          auto HGradu = createZeroVector<ctype, argumentSize>();
+          std::array<HessianType, gridDim> H, DH;
+          for (int i = 0; i < gridDim; ++i) {
+            const auto A_i          = col(alongMatrix, i);
+            const auto [g, Hi, DHi] = contractedDerivatives<true>(u, A_i, gradu, i);
+            H[i]                    = Hi;
+            DH[i]                   = DHi;
+            for (int k = 0; k < argumentSize; ++k) {
+              coeff(G, k, i) = g[k];
+              for (int l = 0; l < argumentSize; ++l)
+                HGradu[k] += coeff(Hi, k, l) * coeff(gradu, l, i);
+            }
+          }
+
+          const auto u_xyzAlongG       = evaluateDerivativeImpl(this->m(), replaceAlong(lfArgs, along(G)));
+          const auto u_c0c1AlongHGradu = evaluateDerivativeImpl(this->m(), replaceAlong(argsForDyz, along(HGradu)));
+          std::remove_cvref_t<decltype(eval(u_xyzAlongG))> res;
+
+          res = u_xyzAlongG + u_c0c1AlongHGradu;
+          for (int i = 0; i < gridDim; ++i)
+            res += leftMultiplyTranspose(gradu_c0[i], leftMultiplyTranspose(H[i], u_c1))
+                   + leftMultiplyTranspose(u_c0, leftMultiplyTranspose(H[i], gradu_c1[i]))
+                   + leftMultiplyTranspose(u_c0, leftMultiplyTranspose(DH[i], u_c1));
+          return res;
+        } else
+          static_assert(
+              LFArgs::hasOneSpatialSingle or LFArgs::hasOneSpatialAll,
+              "Only a spatial single direction or all spatial directions are supported. You should not end up here.");
+      } else
+        static_assert(DerivativeOrder > 3 or DerivativeOrder < 1,
+                      "Only first, second and third order derivatives are supported.");
+    }
+
+  private:
+    using DJTType     = typename LinearAlgebra::template FixedSizedMatrix<ctype, argumentSize, valueSize>;
+    using HessianType = typename LinearAlgebra::template FixedSizedMatrix<ctype, argumentSize, argumentSize>;
+
+    /* The along argument lambda, which may be omitted for a scalar valued function, then lambda = 1 */
+    template <typename LFArgs>
+    static decltype(auto) alongArgument(const LFArgs &lfArgs) {
+      if constexpr (std::tuple_size_v<std::remove_cvref_t<decltype(lfArgs.alongArgs.args)>> > 0)
+        return std::get<0>(lfArgs.alongArgs.args);
+      else {
+        static_assert(valueSize == 1, "The along argument is only optional for scalar valued functions.");
+        return createOnesVector<ctype, 1>();
+      }
+    }
+
+    /* The i-th entry of a vector or of the i-th column of a matrix, e.g. of the value or the spatial derivatives */
+    template <typename VectorOrMatrix>
+    static auto entry(const VectorOrMatrix &a, int row, int column = 0) {
+      if constexpr (requires { coeff(a, row, column); })
+        return coeff(a, row, column);
+      else
+        return a[row];
+    }
+
+    /* The k-th component of the result of F, which may also be a scalar */
+    template <typename Result>
+    static auto component(const Result &f, int k) {
+      if constexpr (requires { f[k]; })
+        return f[k];
+      else
+        return f;
+    }
+
+    /* Evaluates F with the argument x_i = seed(u_i, i) */
+    template <typename Number, typename Value, typename Seed>
+    static auto evaluateF(const Value &u, Seed &&seed) {
+      typename DefaultLinearAlgebra::template FixedSizedVector<Number, argumentSize> x;
+      for (int i = 0; i < argumentSize; ++i)
+        x[i] = seed(ctype(entry(u, i)), i);
+      return ValueFunction{}(x);
+    }
+
+    /* J^T, i.e. the gradients of the components of F in the columns */
+    template <typename Value>
+    static DJTType transposedJacobian(const Value &u) {
+      using Dual   = VectorDual<ctype, argumentSize>;
+      const auto f = evaluateF<Dual>(u, [](const ctype &ui, int i) { return Dual::variable(ui, i); });
+      DJTType JT;
+      for (int k = 0; k < valueSize; ++k)
+        for (int i = 0; i < argumentSize; ++i)
+          coeff(JT, i, k) = component(f, k).derivative(i);
+      return JT;
+    }
+
+    /* J^T and its derivative in the direction w, which is the given column of the spatial derivatives of u */
+    template <typename Value, typename Direction>
+    static std::pair<DJTType, DJTType> transposedJacobianAndDirectionalDerivative(const Value &u, const Direction &w,
+                                                                                 int column) {
+      using Inner  = VectorDual<ctype, 1>;
+      using Dual   = VectorDual<Inner, argumentSize>;
+      const auto f = evaluateF<Dual>(u, [&](const ctype &ui, int i) {
+        Inner ui_w(ui);
+        ui_w.gradient()[0] = entry(w, i, column);
+        return Dual::variable(ui_w, i);
+      });
+      DJTType JT, DJT;
+      for (int k = 0; k < valueSize; ++k)
+        for (int i = 0; i < argumentSize; ++i) {
+          coeff(JT, i, k)  = component(f, k).derivative(i).value();
+          coeff(DJT, i, k) = component(f, k).derivative(i).derivative(0);
+        }
+      return std::make_pair(JT, DJT);
+    }
+
+    /* g = J^T lambda, the Hessian H of lambda^T F and, if requested, its derivative in the direction w, which is the
+     * given column of the spatial derivatives of u. F is evaluated once, the components are contracted afterwards. */
+    template <bool withDirectionalDerivative, typename Value, typename Along, typename Direction>
+    static auto contractedDerivatives(const Value &u, const Along &lambda, const Direction &w, int column = 0) {
+      using Inner  = std::conditional_t<withDirectionalDerivative, VectorDual<ctype, 1>, ctype>;
+      using Middle = VectorDual<Inner, argumentSize>;
+      using Dual   = VectorDual<Middle, argumentSize>;
+      const auto f = evaluateF<Dual>(u, [&](const ctype &ui, int i) {
+        Inner ui_w(ui);
+        if constexpr (withDirectionalDerivative) ui_w.gradient()[0] = entry(w, i, column);
+        return Dual::variable(Middle::variable(ui_w, i), i);
+      });
+
+      auto g = createZeroVector<ctype, argumentSize>();
+      HessianType H, DH;
+      setZero(H);
+      setZero(DH);
+      for (int k = 0; k < valueSize; ++k) {
+        const ctype lambda_k = entry(lambda, k);
+        const auto &f_k      = component(f, k);
+        for (int i = 0; i < argumentSize; ++i) {
+          if constexpr (withDirectionalDerivative)
+            g[i] += lambda_k * f_k.derivative(i).value().value();
+          else
+            g[i] += lambda_k * f_k.derivative(i).value();
+          for (int j = 0; j < argumentSize; ++j) {
+            if constexpr (withDirectionalDerivative) {
+              coeff(H, i, j) += lambda_k * f_k.derivative(i).derivative(j).value();
+              coeff(DH, i, j) += lambda_k * f_k.derivative(i).derivative(j).derivative(0);
+            } else
+              coeff(H, i, j) += lambda_k * f_k.derivative(i).derivative(j);
+          }
+        }
+      }
+      return std::make_tuple(g, H, DH);
+    }
+  };
+
+  template <typename E1, typename ValueFunction>
+  struct LocalFunctionTraits<VectorFunctionExpr<E1, ValueFunction>> {
+    using E1Raw = std::remove_cvref_t<E1>;
+    /** \brief Type used for coordinates */
+    using ctype = std::common_type_t<typename E1Raw::ctype>;
+    /** \brief The result of the function applied to the value of E1 */
+    using Argument = typename DefaultLinearAlgebra::template FixedSizedVector<ctype, E1Raw::valueSize>;
+    using Result   = std::invoke_result_t<ValueFunction, Argument>;
+    /** \brief Size of the function value */
+    static constexpr int valueSize = requires(Result f) { f[0]; } ? Rows<Result>::value : 1;
+    /** \brief Type for the points for evaluation, usually the integration points */
+    using DomainType = std::common_type_t<typename E1Raw::DomainType>;
+    /** \brief Dimension of the grid */
+    static constexpr int gridDim = E1Raw::gridDim;
+    /** \brief Dimension of the world where this function is mapped to from the reference element */
+    static constexpr int worldDimension = E1Raw::worldDimension;
+  };
+
+  /** \brief Applies a user-defined function to the value of a local function, e.g.
+   * vectorFunction([](const auto& E) { return E[0] * E[0] + E[1] * E[1] + 0.5 * E[2] * E[2]; }, linearStrains(u)).
+   * The function gets a vector and returns a scalar or a vector. Only the function is differentiated automatically, see
+   * VectorFunctionExpr, thus ValueFunction has to be a stateless generic callable, e.g. a lambda without captures. */
+  template <typename ValueFunction, typename E1>
+    requires IsLocalFunction<E1>
+  constexpr auto vectorFunction(ValueFunction, E1 &&u) {
+    return VectorFunctionExpr<E1, ValueFunction>(std::forward<E1>(u));
+  }
+
+}  // namespace Dune
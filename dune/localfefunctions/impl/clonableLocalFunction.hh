@@ -3,6 +3,7 @@
 
 #pragma once
 #include <dune/localfefunctions/meta.hh>
+#include <dune/localfefunctions/transformedDerivativesCache.hh>
 namespace Dune {
 
   template <typename LFImpl>
@@ -23,11 +24,40 @@ namespace Dune {
         return clone();
     }
 
+    /** \brief Sets this local function, which is a rebindClone() of other, to the current coefficients, basis and
+     * geometry of other.
+     *
+     * The coefficients are converted in place and the basis is only copied if it differs from the one of other. Thus,
+     * this does not allocate as long as the number of coefficients and the basis do not change. */
+    template <typename OtherLF>
+    void assignRebound(const OtherLF& other) {
+      LFImpl& self            = underlying();
+      const auto& otherCoeffs = other.coefficientsRef();
+      self.coeffs.resize(otherCoeffs.size());
+      for (std::size_t i = 0; i < otherCoeffs.size(); ++i)
+        self.coeffs[i] = otherCoeffs[i];
+
+      if (not(self.basis_ == other.basis())) {
+        self.basis_                  = other.basis();
+        self.transformedDerivatives_ = makeTransformedDerivativesCache(self.basis_);
+      }
+      // The stored transformed derivatives are identified by the address of the geometry, which may be reused
+      if (self.geometry_ != other.geometry()) {
+        self.geometry_ = other.geometry();
+        self.transformedDerivatives_->invalidate();
+      }
+    }
+
   private:
     constexpr LFImpl const& underlying() const  // CRTP
     {
       return static_cast<LFImpl const&>(*this);
     }
+
+    constexpr LFImpl& underlying()  // CRTP
+    {
+      return static_cast<LFImpl&>(*this);
+    }
   };
 
 }  // namespace Dune
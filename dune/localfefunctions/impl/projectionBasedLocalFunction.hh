@@ -36,8 +36,8 @@ namespace Dune {
                                            = Dune::template index_constant<std::size_t(0)>{})
         : basis_{p_basis},
           coeffs{coeffs_},
-          geometry_{geo}  //          ,coeffsAsMat{Dune::viewAsEigenMatrixFixedDyn(coeffs)}
-    {}
+          geometry_{geo},  //          ,coeffsAsMat{Dune::viewAsEigenMatrixFixedDyn(coeffs)}
+          transformedDerivatives_{makeTransformedDerivativesCache(p_basis)} {}
 
     using Traits = LocalFunctionTraits<ProjectionBasedLocalFunction>;
 
@@ -94,6 +94,20 @@ namespace Dune {
 
     const Dune::CachedLocalBasis<DuneBasis>& basis() const { return basis_; }
 
+    /** \brief Storage of the transformed ansatz function derivatives, which is possibly shared with other leaf nodes of
+     * the same expression */
+    const auto& transformedDerivatives() const { return transformedDerivatives_; }
+
+    /** \brief Reuses the transformed ansatz function derivatives of another leaf node, if it uses the same basis on the
+     * same geometry. Then the derivatives are only transformed once per integration point for both leaf nodes. */
+    template <typename OtherLF>
+    void shareDerivativeTransformationsWith(const OtherLF& other) {
+      if constexpr (std::is_same_v<std::remove_cvref_t<decltype(other.basis())>, Dune::CachedLocalBasis<DuneBasis>>
+                    and std::is_same_v<std::remove_cvref_t<decltype(other.geometry())>, std::shared_ptr<const Geometry>>)
+        if (other.basis() == basis_ and other.geometry() == geometry_)
+          transformedDerivatives_.shareWith(other.transformedDerivatives());
+    }
+
     template <typename OtherType>
     struct rebind {
       using other = ProjectionBasedLocalFunction<
@@ -135,7 +149,8 @@ namespace Dune {
     Jacobian evaluateDerivativeWRTSpaceAllImpl(const DomainTypeOrIntegrationPointIndex& ipIndexOrPosition,
                                                const On<TransformArgs...>& transArgs) const {
       const auto& [N, dNraw] = evaluateFunctionAndDerivativeWithIPorCoord(ipIndexOrPosition, basis_);
-      maytransformDerivatives(dNraw, dNTransformed, transArgs, geometry_, ipIndexOrPosition, basis_);
+      const auto& dNTransformed
+          = maytransformDerivatives(dNraw, *transformedDerivatives_, transArgs, geometry_, ipIndexOrPosition, basis_);
       Jacobian J              = evaluateEmbeddingJacobianImpl(dNTransformed);
       FunctionReturnType valE = evaluateEmbeddingFunctionImpl(N);
       return tryToCallDerivativeOfProjectionWRTposition(valE) * J;
@@ -145,7 +160,8 @@ namespace Dune {
     JacobianColType evaluateDerivativeWRTSpaceSingleImpl(const DomainTypeOrIntegrationPointIndex& ipIndexOrPosition,
                                                          int spaceIndex, const On<TransformArgs...>& transArgs) const {
       const auto& [N, dNraw] = evaluateFunctionAndDerivativeWithIPorCoord(ipIndexOrPosition, basis_);
-      maytransformDerivatives(dNraw, dNTransformed, transArgs, geometry_, ipIndexOrPosition, basis_);
+      const auto& dNTransformed
+          = maytransformDerivatives(dNraw, *transformedDerivatives_, transArgs, geometry_, ipIndexOrPosition, basis_);
       JacobianColType Jcol    = evaluateEmbeddingJacobianColImpl(dNTransformed, spaceIndex);
       FunctionReturnType valE = evaluateEmbeddingFunctionImpl(N);
       return tryToCallDerivativeOfProjectionWRTposition(valE) * Jcol;
@@ -206,7 +222,8 @@ namespace Dune {
         const DomainTypeOrIntegrationPointIndex& ipIndexOrPosition, int coeffsIndex,
         const On<TransformArgs...>& transArgs) const {
       const auto& [N, dNraw] = evaluateFunctionAndDerivativeWithIPorCoord(ipIndexOrPosition, basis_);
-      maytransformDerivatives(dNraw, dNTransformed, transArgs, geometry_, ipIndexOrPosition, basis_);
+      const auto& dNTransformed
+          = maytransformDerivatives(dNraw, *transformedDerivatives_, transArgs, geometry_, ipIndexOrPosition, basis_);
       const FunctionReturnType valE = evaluateEmbeddingFunctionImpl(N);
       const Jacobian J              = evaluateEmbeddingJacobianImpl(dNTransformed);
       const CoeffDerivEukMatrix Pm  = tryToCallDerivativeOfProjectionWRTposition(valE);
@@ -233,7 +250,8 @@ namespace Dune {
         const DomainTypeOrIntegrationPointIndex& ipIndexOrPosition, int coeffsIndex, int spatialIndex,
         const On<TransformArgs...>& transArgs) const {
       const auto& [N, dNraw] = evaluateFunctionAndDerivativeWithIPorCoord(ipIndexOrPosition, basis_);
-      maytransformDerivatives(dNraw, dNTransformed, transArgs, geometry_, ipIndexOrPosition, basis_);
+      const auto& dNTransformed
+          = maytransformDerivatives(dNraw, *transformedDerivatives_, transArgs, geometry_, ipIndexOrPosition, basis_);
       const FunctionReturnType valE = evaluateEmbeddingFunctionImpl(N);
       const JacobianColType Jcol    = evaluateEmbeddingJacobianColImpl(dNTransformed, spatialIndex);
       const CoeffDerivEukMatrix Pm  = tryToCallDerivativeOfProjectionWRTposition(valE);
@@ -249,7 +267,8 @@ namespace Dune {
         const Along<AlongArgs...>& alongArgs, const On<TransformArgs...>& transArgs) const {
       const auto& [N, dNraw] = evaluateFunctionAndDerivativeWithIPorCoord(ipIndexOrPosition, basis_);
 
-      maytransformDerivatives(dNraw, dNTransformed, transArgs, geometry_, ipIndexOrPosition, basis_);
+      const auto& dNTransformed
+          = maytransformDerivatives(dNraw, *transformedDerivatives_, transArgs, geometry_, ipIndexOrPosition, basis_);
       const FunctionReturnType valE = evaluateEmbeddingFunctionImpl(N);
       const Jacobian J              = evaluateEmbeddingJacobianImpl(dNTransformed);
       const auto& along             = std::get<0>(alongArgs.args);
@@ -291,7 +310,8 @@ namespace Dune {
         const DomainTypeOrIntegrationPointIndex& ipIndexOrPosition, const std::array<size_t, 2>& coeffsIndex,
         const int spatialIndex, const Along<AlongArgs...>& alongArgs, const On<TransformArgs...>& transArgs) const {
       const auto& [N, dNraw] = evaluateFunctionAndDerivativeWithIPorCoord(ipIndexOrPosition, basis_);
-      maytransformDerivatives(dNraw, dNTransformed, transArgs, geometry_, ipIndexOrPosition, basis_);
+      const auto& dNTransformed
+          = maytransformDerivatives(dNraw, *transformedDerivatives_, transArgs, geometry_, ipIndexOrPosition, basis_);
       const FunctionReturnType valE = evaluateEmbeddingFunctionImpl(N);
       const Jacobian J              = evaluateEmbeddingJacobianImpl(dNTransformed);
       const auto& along             = std::get<0>(alongArgs.args);
@@ -352,10 +372,10 @@ namespace Dune {
       return res;
     }
 
-    mutable AnsatzFunctionJacobian dNTransformed;
     Dune::CachedLocalBasis<DuneBasis> basis_;
     CoeffContainer coeffs;
     std::shared_ptr<const Geometry> geometry_;
+    TransformedDerivativesStorage<AnsatzFunctionJacobian> transformedDerivatives_;
     //    const decltype(Dune::viewAsEigenMatrixFixedDyn(coeffs)) coeffsAsMat;
   };
 
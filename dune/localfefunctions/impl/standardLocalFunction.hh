@@ -35,8 +35,8 @@ namespace Dune {
                                     Dune::template index_constant<ID> = Dune::template index_constant<std::size_t(0)>{})
         : basis_{p_basis},
           coeffs{coeffs_},
-          geometry_{geo}  //        ,  coeffsAsMat{Dune::viewAsEigenMatrixFixedDyn(coeffs)}
-    {}
+          geometry_{geo},  //        ,  coeffsAsMat{Dune::viewAsEigenMatrixFixedDyn(coeffs)}
+          transformedDerivatives_{makeTransformedDerivativesCache(p_basis)} {}
 
     static constexpr bool isLeaf = true;
     static constexpr std::array<int, 1> id{ID};
@@ -96,6 +96,29 @@ namespace Dune {
 
     const Dune::CachedLocalBasis<DuneBasis>& basis() const { return basis_; }
 
+    /** \brief Storage of the transformed ansatz function derivatives, which is possibly shared with other leaf nodes of
+     * the same expression */
+    const auto& transformedDerivatives() const { return transformedDerivatives_; }
+
+    /** \brief Reuses the transformed ansatz function derivatives of another leaf node, if it uses the same basis on the
+     * same geometry. Then the derivatives are only transformed once per integration point for both leaf nodes. */
+    template <typename OtherLF>
+    void shareDerivativeTransformationsWith(const OtherLF& other) {
+      if constexpr (std::is_same_v<std::remove_cvref_t<decltype(other.basis())>, Dune::CachedLocalBasis<DuneBasis>>
+                    and std::is_same_v<std::remove_cvref_t<decltype(other.geometry())>, std::shared_ptr<const Geometry>>)
+        if (other.basis() == basis_ and other.geometry() == geometry_)
+          transformedDerivatives_.shareWith(other.transformedDerivatives());
+    }
+
+    /** \brief Returns the spatial derivatives of all ansatz functions, transformed as requested. The reference stays
+     * valid until this or a leaf node sharing its transformed derivatives is evaluated at another point. */
+    template <typename DomainTypeOrIntegrationPointIndex, typename... TransformArgs>
+    const AnsatzFunctionJacobian& evaluateAnsatzFunctionDerivatives(
+        const DomainTypeOrIntegrationPointIndex& ipIndexOrPosition, const On<TransformArgs...>& transArgs) const {
+      const auto& dNraw = evaluateDerivativeWithIPorCoord(ipIndexOrPosition, basis_);
+      return maytransformDerivatives(dNraw, *transformedDerivatives_, transArgs, geometry_, ipIndexOrPosition, basis_);
+    }
+
   private:
     template <typename DomainTypeOrIntegrationPointIndex, typename... TransformArgs>
     FunctionReturnType evaluateFunctionImpl(const DomainTypeOrIntegrationPointIndex& ipIndexOrPosition,
@@ -115,7 +138,8 @@ namespace Dune {
     Jacobian evaluateDerivativeWRTSpaceAllImpl(const DomainTypeOrIntegrationPointIndex& ipIndexOrPosition,
                                                const On<TransformArgs...>& transArgs) const {
       const auto& dNraw = evaluateDerivativeWithIPorCoord(ipIndexOrPosition, basis_);
-      maytransformDerivatives(dNraw, dNTransformed, transArgs, geometry_, ipIndexOrPosition, basis_);
+      const auto& dNTransformed
+          = maytransformDerivatives(dNraw, *transformedDerivatives_, transArgs, geometry_, ipIndexOrPosition, basis_);
       Jacobian J;
       setZero(J);
       for (size_t j = 0; j < gridDim; ++j)
@@ -129,7 +153,8 @@ namespace Dune {
     JacobianColType evaluateDerivativeWRTSpaceSingleImpl(const DomainTypeOrIntegrationPointIndex& ipIndexOrPosition,
                                                          int spaceIndex, const On<TransformArgs...>& transArgs) const {
       const auto& dNraw = evaluateDerivativeWithIPorCoord(ipIndexOrPosition, basis_);
-      maytransformDerivatives(dNraw, dNTransformed, transArgs, geometry_, ipIndexOrPosition, basis_);
+      const auto& dNTransformed
+          = maytransformDerivatives(dNraw, *transformedDerivatives_, transArgs, geometry_, ipIndexOrPosition, basis_);
 
       JacobianColType Jcol;
       setZero(Jcol);
@@ -155,7 +180,8 @@ namespace Dune {
         const DomainTypeOrIntegrationPointIndex& ipIndexOrPosition, int coeffsIndex,
         const On<TransformArgs...>& transArgs) const {
       const auto& dNraw = evaluateDerivativeWithIPorCoord(ipIndexOrPosition, basis_);
-      maytransformDerivatives(dNraw, dNTransformed, transArgs, geometry_, ipIndexOrPosition, basis_);
+      const auto& dNTransformed
+          = maytransformDerivatives(dNraw, *transformedDerivatives_, transArgs, geometry_, ipIndexOrPosition, basis_);
       std::array<CoeffDerivMatrix, gridDim> Warray;
       for (int dir = 0; dir < gridDim; ++dir) {
         setZero(Warray[dir]);
@@ -170,16 +196,17 @@ namespace Dune {
         const DomainTypeOrIntegrationPointIndex& ipIndexOrPosition, int coeffsIndex, int spatialIndex,
         const On<TransformArgs...>& transArgs) const {
       const auto& dNraw = evaluateDerivativeWithIPorCoord(ipIndexOrPosition, basis_);
-      maytransformDerivatives(dNraw, dNTransformed, transArgs, geometry_, ipIndexOrPosition, basis_);
+      const auto& dNTransformed
+          = maytransformDerivatives(dNraw, *transformedDerivatives_, transArgs, geometry_, ipIndexOrPosition, basis_);
       CoeffDerivMatrix W
           = createScaledIdentityMatrix<ctype, valueSize, valueSize>(coeff(dNTransformed, coeffsIndex, spatialIndex));
       return W;
     }
 
-    mutable AnsatzFunctionJacobian dNTransformed;
     Dune::CachedLocalBasis<DuneBasis> basis_;
     CoeffContainer coeffs;
     std::shared_ptr<const Geometry> geometry_;
+    TransformedDerivativesStorage<AnsatzFunctionJacobian> transformedDerivatives_;
     //    const decltype(Dune::viewAsEigenMatrixFixedDyn(coeffs)) coeffsAsMat;
   };
 
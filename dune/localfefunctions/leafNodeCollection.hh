@@ -40,6 +40,33 @@ namespace Dune {
         static_assert("There are currently no other expressions. Thus you should not end up here.");
     }
 
+    /* Collects the leaf nodes, which are owned by the expression, i.e. which are reached without passing an operand
+     * that is stored by reference */
+    template <bool owned, typename LF>
+    auto collectOwnedLeafNodesImpl(LF& a) {
+      using LFRaw = std::remove_cvref_t<LF>;
+      if constexpr (not owned or IsArithmeticExpr<LFRaw>)
+        return std::make_tuple();
+      else if constexpr (IsBinaryExpr<LFRaw>)
+        return std::tuple_cat(collectOwnedLeafNodesImpl<LFRaw::template ownsOperand<0>>(a.l()),
+                              collectOwnedLeafNodesImpl<LFRaw::template ownsOperand<1>>(a.r()));
+      else if constexpr (IsUnaryExpr<LFRaw>)
+        return std::make_tuple(collectOwnedLeafNodesImpl<LFRaw::template ownsOperand<0>>(a.m()));
+      else
+        return std::make_tuple(std::ref(a));
+    }
+
+    template <typename LeafNodeTuple>
+    void shareDerivativeTransformationsOfLeafNodes(LeafNodeTuple& leafNodes) {
+      Dune::Hybrid::forEach(leafNodes, [&](auto& lfi) {
+        Dune::Hybrid::forEach(leafNodes, [&](auto& lfj) {
+          if constexpr (requires { lfj.shareDerivativeTransformationsWith(lfi); })
+            if (static_cast<const void*>(&lfi) != static_cast<const void*>(&lfj))
+              lfj.shareDerivativeTransformationsWith(lfi);
+        });
+      });
+    }
+
   }  // namespace Impl
 
   template <typename LF>
@@ -128,4 +155,25 @@ namespace Dune {
   auto collectLeafNodeLocalFunctions(LF&& lf) {
     return LocalFunctionLeafNodeCollection<LF>(std::forward<LF>(lf));
   }
+
+  /** Leaf nodes of the passed local functions, which use the same basis on the same geometry, share the storage of
+   * their transformed ansatz function derivatives. Thus, the transformation is carried out only once per integration
+   * point. Leaf nodes which are only accessible by const reference are left untouched. Expressions do this on their
+   * own only for the leaf nodes they own, thus this function is the explicit opt-in for leaf nodes held by the caller,
+   * which then must not be evaluated concurrently. */
+  template <typename... LF>
+  void shareDerivativeTransformations(LF&&... lfs) {
+    auto leafNodes
+        = Std::makeNestedTupleFlatAndStoreReferences(std::tuple_cat(Impl::collectNonArithmeticLeafNodesImpl(lfs)...));
+    Impl::shareDerivativeTransformationsOfLeafNodes(leafNodes);
+  }
+
+  /** Shares the transformed ansatz function derivatives between the leaf nodes owned by the operands of an expression,
+   * see shareDerivativeTransformations(). Operands which are stored by reference are left untouched. */
+  template <bool ownsFirst, bool ownsSecond, typename E1, typename E2>
+  void shareOwnedDerivativeTransformations(E1& first, E2& second) {
+    auto leafNodes = Std::makeNestedTupleFlatAndStoreReferences(std::tuple_cat(
+        Impl::collectOwnedLeafNodesImpl<ownsFirst>(first), Impl::collectOwnedLeafNodesImpl<ownsSecond>(second)));
+    Impl::shareDerivativeTransformationsOfLeafNodes(leafNodes);
+  }
 }  // namespace Dune
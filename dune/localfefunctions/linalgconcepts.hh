@@ -67,8 +67,10 @@ namespace Dune {
     template <typename ScalarType, int cols>
     using VarFixSizedMatrix = Eigen::Matrix<ScalarType, Eigen::Dynamic, cols>;
 
+    /* Eigen has no scaled identity matrix, the diagonal matrix is the closest structured type. It keeps derivatives
+     * w.r.t. coefficients from being stored and multiplied as dense matrices. */
     template <typename ScalarType, int rows>
-    using FixedSizedScaledIdentityMatrix = Eigen::Matrix<ScalarType, rows, rows>;
+    using FixedSizedScaledIdentityMatrix = Eigen::DiagonalMatrix<ScalarType, rows>;
 
     template <typename ScalarType, int rows>
     static auto createZeroVector() {
@@ -91,8 +93,8 @@ namespace Dune {
     }
 
     template <typename ScalarType, int rows>
-    static Eigen::Matrix<ScalarType, rows, rows> createScaledIdentityMatrix(const ScalarType& val) {
-      return (Eigen::Matrix<ScalarType, rows, rows>::Identity() * val).eval();
+    static Eigen::DiagonalMatrix<ScalarType, rows> createScaledIdentityMatrix(const ScalarType& val) {
+      return Eigen::DiagonalMatrix<ScalarType, rows>(Eigen::Vector<ScalarType, rows>::Constant(val));
     }
   };
 #endif
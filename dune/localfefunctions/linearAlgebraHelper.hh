@@ -430,6 +430,24 @@ namespace Dune {
     return BT * Dune::FieldMatrix<field_type, rows, rows>(A);
   }
 
+  template <typename field_type, int rows, int cols1>
+  auto leftMultiplyTranspose(const Dune::FieldMatrix<field_type, rows, cols1>& B,
+                             const Dune::ScaledIdentityMatrix<field_type, rows>& A) {
+    Dune::FieldMatrix<field_type, cols1, rows> BT;
+    Dune::MatrixVector::transpose(B, BT);
+
+    BT *= A.scalar();
+    return BT;
+  }
+
+  template <typename field_type, int rows, int cols>
+  auto leftMultiplyTranspose(const Dune::ScaledIdentityMatrix<field_type, rows>& B,
+                             const Dune::FieldMatrix<field_type, rows, cols>& A) {
+    Dune::FieldMatrix<field_type, rows, cols> y = A;
+    y *= B.scalar();
+    return y;
+  }
+
   template <typename field_type, int rows>
   auto operator+(const Dune::FieldMatrix<field_type, rows, rows>& B, const Dune::DiagonalMatrix<field_type, rows>& A) {
     auto y = B;
@@ -887,6 +905,20 @@ namespace Dune {
     return a;
   }
 
+  /** \brief Seeds the automatic differentiation numbers of a, e.g. VectorDual, such that the j-th entry of the i-th
+   * block in the embedding is associated with the lane i * valueSize + j. Returns the number of seeded lanes. */
+  template <typename Type>
+  int seedInEmbedding(Dune::BlockVector<Type>& a) {
+    using ctype           = typename Type::ctype;
+    const int seededLanes = static_cast<int>(a.size()) * Type::valueSize;
+    if (seededLanes > ctype::lanes)
+      DUNE_THROW(Dune::RangeError, seededLanes << " coefficients in the embedding exceed " << ctype::lanes << " lanes");
+    for (auto i = 0U; i < a.size(); ++i)
+      for (int j = 0; j < Type::valueSize; ++j)
+        a[i][j] = ctype::variable(a[i][j].value(), i * Type::valueSize + j);
+    return seededLanes;
+  }
+
   /** \brief Adding free norm function to Eigen types */
   template <typename Derived>
     requires(!std::floating_point<Derived>)
@@ -964,9 +996,52 @@ namespace Dune {
     return b + a;
   }
 
+  /** \brief Eigen::DiagonalMatrix - Eigen::Matrix subtraction missing in Eigen*/
+  template <typename Derived, typename Scalar, int size>
+  auto operator-(const Eigen::MatrixBase<Derived>& a, const Eigen::DiagonalMatrix<Scalar, size>& b) {
+    auto c = a.derived().eval();
+    c.diagonal() -= b.diagonal();
+    return c;
+  }
+
+  /** \brief Eigen::Matrix - Eigen::DiagonalMatrix subtraction missing in Eigen*/
+  template <typename Derived, typename Scalar, int size>
+  auto operator-(const Eigen::DiagonalMatrix<Scalar, size>& a, const Eigen::MatrixBase<Derived>& b) {
+    auto c = (-b.derived()).eval();
+    c.diagonal() += a.diagonal();
+    return c;
+  }
+
+  template <typename Scalar, int size>
+  Eigen::DiagonalMatrix<Scalar, size> operator-(const Eigen::DiagonalMatrix<Scalar, size>& a) {
+    return Eigen::DiagonalMatrix<Scalar, size>(-a.diagonal());
+  }
+
+  /** \brief Scaling of Eigen::DiagonalMatrix missing in Eigen*/
+  template <typename Scalar, int size, typename Factor>
+    requires Concepts::MultiplyAssignAble<Scalar, Factor>
+  Eigen::DiagonalMatrix<Scalar, size>& operator*=(Eigen::DiagonalMatrix<Scalar, size>& a, const Factor& b) {
+    a.diagonal() *= b;
+    return a;
+  }
+
+  /** \brief  This multiplies a vector or matrix from left to a diagonal matrix, y = x^T D. The result is dense but only
+   * the diagonal entries of D are touched */
+  template <typename Derived, typename Scalar, int size>
+  auto leftMultiplyTranspose(const Eigen::MatrixBase<Derived>& B, const Eigen::DiagonalMatrix<Scalar, size>& A) {
+    return B.transpose() * A;
+  }
+
+  template <typename Derived, typename Scalar, int size>
+  auto leftMultiplyTranspose(const Eigen::DiagonalMatrix<Scalar, size>& B, const Eigen::MatrixBase<Derived>& A) {
+    return B * A.derived();
+  }
+
+  /** \brief  The product D_1^T D_2 of two diagonal matrices stays diagonal */
   template <typename Scalar, int size>
-  Dune::DiagonalMatrix<Scalar, size> operator-(const Eigen::DiagonalMatrix<Scalar, size>& a) {
-    return (-a.diagonal()).asDiagonal();
+  Eigen::DiagonalMatrix<Scalar, size> leftMultiplyTranspose(const Eigen::DiagonalMatrix<Scalar, size>& B,
+                                                            const Eigen::DiagonalMatrix<Scalar, size>& A) {
+    return Eigen::DiagonalMatrix<Scalar, size>(B.diagonal().cwiseProduct(A.diagonal()));
   }
 
   template <typename Scalar, int size>
@@ -1003,6 +1078,16 @@ namespace Dune {
     return a;
   }
 
+  template <typename Scalar, int rows, int cols>
+  auto operator+(Dune::DerivativeDirections::ZeroMatrix, const Dune::FieldMatrix<Scalar, rows, cols>& a) {
+    return a;
+  }
+
+  template <typename Scalar, int rows, int cols>
+  auto& operator+=(Dune::FieldMatrix<Scalar, rows, cols>& a, Dune::DerivativeDirections::ZeroMatrix) {
+    return a;
+  }
+
   template <typename Scalar, int size>
   auto operator+(Dune::DerivativeDirections::ZeroMatrix, const Eigen::DiagonalMatrix<Scalar, size>& a) {
     return a.derived();
@@ -1085,6 +1170,32 @@ namespace Dune {
     return a.diagonal()[i];
   }
 
+  template <typename Scalar, typename Scalar2, int size>
+  void setDiagonal(Eigen::DiagonalMatrix<Scalar, size>& a, const Scalar2& val) {
+    a.diagonal().setConstant(val);
+  }
+
+  template <typename Scalar, int size>
+  void setZero(Eigen::DiagonalMatrix<Scalar, size>& a) {
+    a.setZero();
+  }
+
+  template <typename Scalar, int size>
+  auto& getDiagonalEntry(Eigen::DiagonalMatrix<Scalar, size>& a, int i) {
+    return a.diagonal()[i];
+  }
+
+  template <typename Scalar, int size>
+  auto& getDiagonalEntry(const Eigen::DiagonalMatrix<Scalar, size>& a, int i) {
+    return a.diagonal()[i];
+  }
+
+  /** \brief Read access to the coeffs of Eigen::DiagonalMatrix, the off-diagonal entries are zero */
+  template <typename Scalar, int size>
+  Scalar coeff(const Eigen::DiagonalMatrix<Scalar, size>& a, int row, int col) {
+    return row == col ? a.diagonal()[row] : Scalar{0};
+  }
+
   template <typename Scalar, int size>
   Eigen::DiagonalMatrix<Scalar, size> operator-(Dune::DerivativeDirections::ZeroMatrix,
                                                 const Eigen::DiagonalMatrix<Scalar, size>& a) {
@@ -1102,6 +1213,16 @@ namespace Dune {
     return a;
   }
 
+  template <typename Scalar, int size>
+  auto& transpose(const Eigen::DiagonalMatrix<Scalar, size>& a) {
+    return a;
+  }
+
+  template <typename Scalar, int size>
+  auto transposeEvaluated(const Eigen::DiagonalMatrix<Scalar, size>& a) {
+    return a;
+  }
+
   template <typename Derived, typename Derived2>
   auto operator+(const Eigen::MatrixBase<Derived>& a, const Eigen::DiagonalWrapper<Derived2>& b) {
     auto c = a.derived().eval();
@@ -1376,3 +1497,13 @@ namespace Dune {
   constexpr auto voigtNotationContainer = std::get<dim - 1>(Impl::voigtIndices);
 
 }  // namespace Dune
+
+namespace Eigen {
+  /** \brief Printing of Eigen::DiagonalMatrix missing in Eigen. It is defined in namespace Eigen to be found by
+   * argument dependent lookup */
+  template <typename Scalar, int size>
+  std::ostream& operator<<(std::ostream& os, const Eigen::DiagonalMatrix<Scalar, size>& a) {
+    os << a.toDenseMatrix();
+    return os;
+  }
+}  // namespace Eigen
@@ -8,19 +8,18 @@
 #include <sstream>
 
 #include <dune/localfefunctions/derivativetransformators.hh>
+#include <dune/localfefunctions/transformedDerivativesCache.hh>
 namespace Dune {
 
   /** Helper to evaluate the local basis ansatz function and gradient with an integration point index or coordinate
-   * vector*/
+   * vector. Both paths return references into storage owned by the basis, i.e. no heap allocation takes place */
   template <typename DomainTypeOrIntegrationPointIndex, typename Basis>
   auto evaluateFunctionAndDerivativeWithIPorCoord(const DomainTypeOrIntegrationPointIndex& localOrIpId,
                                                   const Basis& basis) {
     if constexpr (std::is_same_v<DomainTypeOrIntegrationPointIndex, typename Basis::DomainType>) {
-      typename Basis::JacobianType dN;
-      basis.evaluateJacobian(localOrIpId, dN);
-      typename Basis::AnsatzFunctionType N;
-      basis.evaluateFunction(localOrIpId, N);
-      return std::make_tuple(N, dN);
+      const typename Basis::JacobianType& dN      = basis.evaluateJacobian(localOrIpId);
+      const typename Basis::AnsatzFunctionType& N = basis.evaluateFunction(localOrIpId);
+      return std::make_tuple(std::ref(N), std::ref(dN));
     } else if constexpr (std::numeric_limits<DomainTypeOrIntegrationPointIndex>::is_integer) {
       const typename Basis::JacobianType& dN      = basis.evaluateJacobian(localOrIpId);
       const typename Basis::AnsatzFunctionType& N = basis.evaluateFunction(localOrIpId);
@@ -32,14 +31,13 @@ namespace Dune {
                     "derivative should be evaluated");
   }
 
-  /** Helper to evaluate the local basis ansatz function gradient with an integration point index or coordinate vector*/
+  /** Helper to evaluate the local basis ansatz function gradient with an integration point index or coordinate vector.
+   * Returns a reference into storage owned by the basis */
   template <typename DomainTypeOrIntegrationPointIndex, typename Basis>
-  auto evaluateDerivativeWithIPorCoord(const DomainTypeOrIntegrationPointIndex& localOrIpId, const Basis& basis) {
-    if constexpr (std::is_same_v<DomainTypeOrIntegrationPointIndex, typename Basis::DomainType>) {
-      typename Basis::JacobianType dN;
-      basis.evaluateJacobian(localOrIpId, dN);
-      return dN;
-    } else if constexpr (std::numeric_limits<DomainTypeOrIntegrationPointIndex>::is_integer) {
+  decltype(auto) evaluateDerivativeWithIPorCoord(const DomainTypeOrIntegrationPointIndex& localOrIpId,
+                                                 const Basis& basis) {
+    if constexpr (std::is_same_v<DomainTypeOrIntegrationPointIndex, typename Basis::DomainType>
+                  or std::numeric_limits<DomainTypeOrIntegrationPointIndex>::is_integer) {
       const typename Basis::JacobianType& dN = basis.evaluateJacobian(localOrIpId);
       return dN;
     } else
@@ -49,15 +47,15 @@ namespace Dune {
                     "derivative should be evaluated");
   }
 
-  /** Helper to evaluate the local basis ansatz function with an integration point index or coordinate vector*/
+  /** Helper to evaluate the local basis ansatz function with an integration point index or coordinate vector.
+   * Returns a reference into storage owned by the basis */
   template <typename DomainTypeOrIntegrationPointIndex, typename Basis>
-  auto evaluateFunctionWithIPorCoord(const DomainTypeOrIntegrationPointIndex& localOrIpId, const Basis& basis) {
-    if constexpr (std::is_same_v<DomainTypeOrIntegrationPointIndex, typename Basis::DomainType>) {
-      typename Basis::AnsatzFunctionType N;
-      basis.evaluateFunction(localOrIpId, N);
+  decltype(auto) evaluateFunctionWithIPorCoord(const DomainTypeOrIntegrationPointIndex& localOrIpId,
+                                               const Basis& basis) {
+    if constexpr (std::is_same_v<DomainTypeOrIntegrationPointIndex, typename Basis::DomainType>
+                  or std::numeric_limits<DomainTypeOrIntegrationPointIndex>::is_integer) {
+      const typename Basis::AnsatzFunctionType& N = basis.evaluateFunction(localOrIpId);
       return N;
-    } else if constexpr (std::numeric_limits<DomainTypeOrIntegrationPointIndex>::is_integer) {
-      return basis.evaluateFunction(localOrIpId);
     } else
       static_assert(std::is_same_v<DomainTypeOrIntegrationPointIndex, typename Basis::DomainType>
                         or std::is_same_v<DomainTypeOrIntegrationPointIndex, int>,
@@ -77,12 +75,47 @@ namespace Dune {
       if constexpr (std::numeric_limits<DomainTypeOrIntegrationPointIndex>::is_integer) {
         const auto& gp = basis.indexToIntegrationPoint(localOrIpId);
         derivativeTransformer.f(*geo, gp.position(), dNraw, dNTransformed);
-      } else if (std::is_same_v<DomainTypeOrIntegrationPointIndex, typename Basis::DomainType>) {
+      } else if constexpr (std::is_same_v<DomainTypeOrIntegrationPointIndex, typename Basis::DomainType>) {
         derivativeTransformer.f(*geo, localOrIpId, dNraw, dNTransformed);
-      }
+      } else
+        static_assert(std::is_same_v<DomainTypeOrIntegrationPointIndex, typename Basis::DomainType>
+                          or std::is_same_v<DomainTypeOrIntegrationPointIndex, int>,
+                      "The argument you passed should be an id for the integration point or the point where the "
+                      "derivative should be evaluated");
     } else  // DerivativeDirections::ReferenceElement if the quantity should live on the reference element we don't have
             // to transform the derivatives
       dNTransformed = dNraw;
   }
 
+  /** Same as above but the transformed derivatives are stored in a cache, which is possibly shared with other leaf
+   * nodes. If the derivatives are already transformed for the requested integration point, the transformation is
+   * skipped. Returns a reference to the derivatives to use, i.e. the untransformed ones for the reference element */
+  template <typename TransformArg, typename Geometry, typename DomainTypeOrIntegrationPointIndex, typename Basis,
+            typename TransformFunctor = Dune::DefaultFirstOrderTransformFunctor, typename AnsatzFunctionJacobian>
+  const AnsatzFunctionJacobian& maytransformDerivatives(const AnsatzFunctionJacobian& dNraw,
+                                                        TransformedDerivativesCache<AnsatzFunctionJacobian>& cache,
+                                                        const On<TransformArg, TransformFunctor>& derivativeTransformer,
+                                                        const std::shared_ptr<const Geometry>& geo,
+                                                        const DomainTypeOrIntegrationPointIndex& localOrIpId,
+                                                        const Basis& basis) {
+    if constexpr (std::is_same_v<TransformArg, DerivativeDirections::GridElement>) {
+      if constexpr (std::numeric_limits<DomainTypeOrIntegrationPointIndex>::is_integer) {
+        if (not cache.isTransformedFor(localOrIpId, basis.bindingId(), geo.get(), derivativeTransformer.f)) {
+          const auto& gp = basis.indexToIntegrationPoint(localOrIpId);
+          derivativeTransformer.f(*geo, gp.position(), dNraw, cache.derivatives());
+          cache.setTransformedFor(localOrIpId, basis.bindingId(), geo.get(), derivativeTransformer.f);
+        }
+      } else if constexpr (std::is_same_v<DomainTypeOrIntegrationPointIndex, typename Basis::DomainType>) {
+        cache.invalidate();
+        derivativeTransformer.f(*geo, localOrIpId, dNraw, cache.derivatives());
+      } else
+        static_assert(std::is_same_v<DomainTypeOrIntegrationPointIndex, typename Basis::DomainType>
+                          or std::is_same_v<DomainTypeOrIntegrationPointIndex, int>,
+                      "The argument you passed should be an id for the integration point or the point where the "
+                      "derivative should be evaluated");
+      return cache.derivatives();
+    } else
+      return dNraw;
+  }
+
 }  // namespace Dune
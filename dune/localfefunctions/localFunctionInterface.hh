@@ -3,6 +3,8 @@
 
 #pragma once
 #include "derivativetransformators.hh"
+#include "evaluationMemo.hh"
+#include "evaluationProfiler.hh"
 #include "leafNodeCollection.hh"
 #include "localFunctionArguments.hh"
 
@@ -45,6 +47,7 @@ namespace Dune {
                   const On<Transform, TransformFunctor>& transform = {}) const {
       checkIfLocalFunctionCanProvideDerivativeTransformation<Transform>();
       const LocalFunctionEvaluationArgs evalArgs(ipIndexOrPosition, wrt(), along(), transform);
+      startNewEvaluation();
       return evaluateFunctionImpl(*this, evalArgs);
     }
 
@@ -58,6 +61,7 @@ namespace Dune {
 
       const LocalFunctionEvaluationArgs evalArgs(localOrIpId, std::forward<Wrt<WrtArgs...>>(args),
                                                  std::forward<Along<AlongArgs...>>(along), transform);
+      startNewEvaluation();
       return evaluateDerivativeImpl(*this, evalArgs);
     }
 
@@ -212,67 +216,83 @@ namespace Dune {
   template <typename LocalFunctionEvaluationArgs_, typename LocalFunctionImpl>
   auto evaluateFunctionImpl(const LocalFunctionInterface<LocalFunctionImpl>& f,
                             const LocalFunctionEvaluationArgs_& localFunctionArgs) {
-    if constexpr (LocalFunctionImpl::isLeaf)
-      return f.impl().evaluateFunctionImpl(localFunctionArgs.integrationPointOrIndex,
-                                           localFunctionArgs.transformWithArgs);
-    else {
-      return f.impl().evaluateValueOfExpression(localFunctionArgs);
-    }
+    const auto evaluate = [&]() {
+      if constexpr (LocalFunctionImpl::isLeaf)
+        return f.impl().evaluateFunctionImpl(localFunctionArgs.integrationPointOrIndex,
+                                             localFunctionArgs.transformWithArgs);
+      else {
+        return f.impl().evaluateValueOfExpression(localFunctionArgs);
+      }
+    };
+    return profiledEvaluation<true>(f.impl(), localFunctionArgs, [&](auto&& countEvaluation) {
+      return memoizedEvaluation<true>(f, localFunctionArgs, [&]() {
+        countEvaluation();
+        return evaluate();
+      });
+    });
   }
 
   template <typename LocalFunctionArguments, typename LocalFunctionImpl>
   auto evaluateDerivativeImpl(const LocalFunctionInterface<LocalFunctionImpl>& f,
                               const LocalFunctionArguments& localFunctionArgs) {
-    using namespace Dune::Indices;
-    if constexpr (LocalFunctionImpl::isLeaf) {
-      if constexpr (LocalFunctionArguments::hasNoCoeff) {
-        if constexpr (LocalFunctionArguments::hasOneSpatialSingle) {
-          return f.impl().evaluateDerivativeWRTSpaceSingleImpl(localFunctionArgs.integrationPointOrIndex,
-                                                               localFunctionArgs.spatialPartialIndices,
-                                                               localFunctionArgs.transformWithArgs);
-        } else if constexpr (LocalFunctionArguments::hasOneSpatialAll) {
-          return f.impl().evaluateDerivativeWRTSpaceAllImpl(localFunctionArgs.integrationPointOrIndex,
+    const auto evaluate = [&]() {
+      using namespace Dune::Indices;
+      if constexpr (LocalFunctionImpl::isLeaf) {
+        if constexpr (LocalFunctionArguments::hasNoCoeff) {
+          if constexpr (LocalFunctionArguments::hasOneSpatialSingle) {
+            return f.impl().evaluateDerivativeWRTSpaceSingleImpl(localFunctionArgs.integrationPointOrIndex,
+                                                                 localFunctionArgs.spatialPartialIndices,
+                                                                 localFunctionArgs.transformWithArgs);
+          } else if constexpr (LocalFunctionArguments::hasOneSpatialAll) {
+            return f.impl().evaluateDerivativeWRTSpaceAllImpl(localFunctionArgs.integrationPointOrIndex,
+                                                              localFunctionArgs.transformWithArgs);
+          }
+        } else if constexpr (LocalFunctionArguments::hasSingleCoeff) {
+          if constexpr (decltype(localFunctionArgs.coeffsIndices[_0])::value != LocalFunctionImpl::id[0])
+            return DerivativeDirections::ZeroMatrix();
+          else if constexpr (LocalFunctionArguments::hasNoSpatial) {
+            return f.impl().evaluateDerivativeWRTCoeffsImpl(localFunctionArgs.integrationPointOrIndex,
+                                                            localFunctionArgs.coeffsIndices[1],
                                                             localFunctionArgs.transformWithArgs);
+          } else if constexpr (LocalFunctionArguments::hasOneSpatialSingle) {
+            return f.impl().evaluateDerivativeWRTCoeffsANDSpatialSingleImpl(
+                localFunctionArgs.integrationPointOrIndex, localFunctionArgs.coeffsIndices[1],
+                localFunctionArgs.spatialPartialIndices, localFunctionArgs.transformWithArgs);
+          } else if constexpr (LocalFunctionArguments::hasOneSpatialAll) {
+            return f.impl().evaluateDerivativeWRTCoeffsANDSpatialImpl(localFunctionArgs.integrationPointOrIndex,
+                                                                      localFunctionArgs.coeffsIndices[1],
+                                                                      localFunctionArgs.transformWithArgs);
+          }
+        } else if constexpr (LocalFunctionArguments::hasTwoCoeff) {
+          if constexpr (LocalFunctionArguments::hasNoSpatial) {
+            return f.impl().evaluateSecondDerivativeWRTCoeffsImpl(
+                localFunctionArgs.integrationPointOrIndex,
+                {localFunctionArgs.coeffsIndices.first[1], localFunctionArgs.coeffsIndices.second[1]},
+                localFunctionArgs.alongArgs, localFunctionArgs.transformWithArgs);
+          } else if constexpr (LocalFunctionArguments::hasOneSpatialSingle) {
+            return f.impl().evaluateThirdDerivativeWRTCoeffsTwoTimesAndSpatialSingleImpl(
+                localFunctionArgs.integrationPointOrIndex,
+                {localFunctionArgs.coeffsIndices.first[1], localFunctionArgs.coeffsIndices.second[1]},
+                localFunctionArgs.spatialPartialIndices, localFunctionArgs.alongArgs,
+                localFunctionArgs.transformWithArgs);
+          } else if constexpr (LocalFunctionArguments::hasOneSpatialAll) {
+            return f.impl().evaluateThirdDerivativeWRTCoeffsTwoTimesAndSpatialImpl(
+                localFunctionArgs.integrationPointOrIndex,
+                {localFunctionArgs.coeffsIndices.first[1], localFunctionArgs.coeffsIndices.second[1]},
+                localFunctionArgs.alongArgs, localFunctionArgs.transformWithArgs);
+          }
         }
-      } else if constexpr (LocalFunctionArguments::hasSingleCoeff) {
-        if constexpr (decltype(localFunctionArgs.coeffsIndices[_0])::value != LocalFunctionImpl::id[0])
-          return DerivativeDirections::ZeroMatrix();
-        else if constexpr (LocalFunctionArguments::hasNoSpatial) {
-          return f.impl().evaluateDerivativeWRTCoeffsImpl(localFunctionArgs.integrationPointOrIndex,
-                                                          localFunctionArgs.coeffsIndices[1],
-                                                          localFunctionArgs.transformWithArgs);
-        } else if constexpr (LocalFunctionArguments::hasOneSpatialSingle) {
-          return f.impl().evaluateDerivativeWRTCoeffsANDSpatialSingleImpl(
-              localFunctionArgs.integrationPointOrIndex, localFunctionArgs.coeffsIndices[1],
-              localFunctionArgs.spatialPartialIndices, localFunctionArgs.transformWithArgs);
-        } else if constexpr (LocalFunctionArguments::hasOneSpatialAll) {
-          return f.impl().evaluateDerivativeWRTCoeffsANDSpatialImpl(localFunctionArgs.integrationPointOrIndex,
-                                                                    localFunctionArgs.coeffsIndices[1],
-                                                                    localFunctionArgs.transformWithArgs);
-        }
-      } else if constexpr (LocalFunctionArguments::hasTwoCoeff) {
-        if constexpr (LocalFunctionArguments::hasNoSpatial) {
-          return f.impl().evaluateSecondDerivativeWRTCoeffsImpl(
-              localFunctionArgs.integrationPointOrIndex,
-              {localFunctionArgs.coeffsIndices.first[1], localFunctionArgs.coeffsIndices.second[1]},
-              localFunctionArgs.alongArgs, localFunctionArgs.transformWithArgs);
-        } else if constexpr (LocalFunctionArguments::hasOneSpatialSingle) {
-          return f.impl().evaluateThirdDerivativeWRTCoeffsTwoTimesAndSpatialSingleImpl(
-              localFunctionArgs.integrationPointOrIndex,
-              {localFunctionArgs.coeffsIndices.first[1], localFunctionArgs.coeffsIndices.second[1]},
-              localFunctionArgs.spatialPartialIndices, localFunctionArgs.alongArgs,
-              localFunctionArgs.transformWithArgs);
-        } else if constexpr (LocalFunctionArguments::hasOneSpatialAll) {
-          return f.impl().evaluateThirdDerivativeWRTCoeffsTwoTimesAndSpatialImpl(
-              localFunctionArgs.integrationPointOrIndex,
-              {localFunctionArgs.coeffsIndices.first[1], localFunctionArgs.coeffsIndices.second[1]},
-              localFunctionArgs.alongArgs, localFunctionArgs.transformWithArgs);
-        }
+      } else {
+        return f.impl().template evaluateDerivativeOfExpression<LocalFunctionArguments::derivativeOrder>(
+            localFunctionArgs);
       }
-    } else {
-      return f.impl().template evaluateDerivativeOfExpression<LocalFunctionArguments::derivativeOrder>(
-          localFunctionArgs);
-    }
+    };
+    return profiledEvaluation<false>(f.impl(), localFunctionArgs, [&](auto&& countEvaluation) {
+      return memoizedEvaluation<false>(f, localFunctionArgs, [&]() {
+        countEvaluation();
+        return evaluate();
+      });
+    });
   }
 
   template <typename LocalFunctionArguments, typename LocalFunctionImpl>
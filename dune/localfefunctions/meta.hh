@@ -224,6 +224,9 @@ namespace Dune {
   template <typename E1, typename E2>
   class ScaleExpr;
 
+  template <typename E1>
+  class NegateExpr;
+
   template <typename LocalFunctionImpl>
   class LocalFunctionInterface;
 
@@ -238,6 +241,13 @@ namespace Dune {
   template <typename LF>
   concept IsScaleExpr = Std::isSpecialization<ScaleExpr, std::remove_cvref_t<LF>>::value;
 
+  template <typename LF>
+  concept IsNegateExpr = Std::isSpecialization<NegateExpr, std::remove_cvref_t<LF>>::value;
+
+  /* Expressions passed as temporaries can be rewritten by the operators, since nobody else refers to them */
+  template <typename LF>
+  concept IsTemporary = !std::is_lvalue_reference_v<LF>;
+
   template <typename LF>
   concept IsNonArithmeticLeafNode
       = std::remove_cvref_t<LF>::isLeaf == true and !IsArithmeticExpr<std::remove_cvref_t<LF>>;
@@ -0,0 +1,316 @@
+// SPDX-FileCopyrightText: 2022 The dune-localfefunction developers mueller@ibb.uni-stuttgart.de
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#pragma once
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+#include <ostream>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+#include <dune/common/typetraits.hh>
+
+#include <Eigen/Core>
+
+namespace Dune {
+
+  /** \brief The record of the operations of reverse mode automatic differentiation with ReverseScalar.
+   *
+   * The independent variables are the first nodes of the tape. All other nodes store the indices of their at most two
+   * arguments and the partial derivatives w.r.t. them. The storage is kept if the tape is rewound, thus recording the
+   * evaluation of the same expression again, e.g. at the next integration point, does not allocate. */
+  template <typename ScalarType>
+  class ReverseTape {
+  public:
+    /** \brief Registers the independent variable with the given index. All nodes after it are discarded. */
+    void variable(int index) {
+      nodes_.resize(std::min<std::size_t>(nodes_.size(), index));
+      while (static_cast<int>(nodes_.size()) <= index)
+        nodes_.push_back(Node{{-1, -1}, {ScalarType(0), ScalarType(0)}});
+      variables_ = nodes_.size();
+    }
+
+    /** \brief Records an operation with the arguments a and b and the partial derivatives da and db. Constant arguments
+     * have the index -1. Returns the index of the result. */
+    int record(int a, const ScalarType& da, int b = -1, const ScalarType& db = ScalarType(0)) {
+      nodes_.push_back(Node{{a, b}, {da, db}});
+      return static_cast<int>(nodes_.size()) - 1;
+    }
+
+    /** \brief Discards all recorded operations, but keeps the independent variables */
+    void rewind() { nodes_.resize(variables_); }
+
+    /** \brief Discards all nodes including the independent variables */
+    void clear() {
+      nodes_.clear();
+      variables_ = 0;
+    }
+
+    void reserve(std::size_t size) {
+      nodes_.reserve(size);
+      adjoints_.reserve(size);
+    }
+
+    std::size_t size() const { return nodes_.size(); }
+    std::size_t variables() const { return variables_; }
+
+    /** \brief The derivatives of the node with the given index w.r.t. all independent variables by a reverse sweep.
+     * The returned view is valid until the next call. */
+    std::span<const ScalarType> gradient(int output) {
+      adjoints_.assign(std::max<std::size_t>(output + 1, variables_), ScalarType(0));
+      if (output >= 0) adjoints_[output] = ScalarType(1);
+      for (int i = output; i >= static_cast<int>(variables_); --i)
+        for (int k = 0; k < 2; ++k)
+          if (const int arg = nodes_[i].args[k]; arg >= 0) adjoints_[arg] += nodes_[i].partials[k] * adjoints_[i];
+      return std::span<const ScalarType>(adjoints_.data(), variables_);
+    }
+
+  private:
+    struct Node {
+      std::array<int, 2> args;
+      std::array<ScalarType, 2> partials;
+    };
+
+    std::vector<Node> nodes_;
+    std::vector<ScalarType> adjoints_;
+    std::size_t variables_{0};
+  };
+
+  /** \brief The tape of all ReverseScalar<ScalarType> on this thread */
+  template <typename ScalarType>
+  ReverseTape<ScalarType>& reverseTape() {
+    static thread_local ReverseTape<ScalarType> tape;
+    return tape;
+  }
+
+  /** \brief A reverse mode automatic differentiation number, whose operations are recorded on reverseTape().
+   *
+   * For a scalar valued expression, the gradient w.r.t. all seeded coefficients is obtained by a single reverse sweep,
+   * see ReverseTape::gradient() and seededRebindClone(). The ScalarType can itself be a forward mode type, e.g. with
+   * ReverseScalar<VectorDual<double, 1>> the derivatives of the gradient in the direction of the forward mode seeds,
+   * i.e. a Hessian-vector product, are obtained by the same sweep. */
+  template <typename ScalarType>
+  class ReverseScalar {
+  public:
+    /** \brief There is no upper bound for the number of independent variables */
+    static constexpr int lanes = std::numeric_limits<int>::max();
+
+    ReverseScalar() : ReverseScalar(ScalarType(0)) {}
+
+    /** \brief Creates a constant, which is not recorded */
+    ReverseScalar(const ScalarType& val) : val_{val} {}
+
+    /** \brief Creates a constant from a number, e.g. from literals */
+    template <typename Number>
+      requires(std::is_arithmetic_v<Number> and not std::is_same_v<Number, ScalarType>)
+    ReverseScalar(const Number& val) : ReverseScalar(ScalarType(val)) {}
+
+    /** \brief Creates the independent variable with the given index on the tape, see ReverseTape::variable() */
+    static ReverseScalar variable(const ScalarType& val, int index) {
+      reverseTape<ScalarType>().variable(index);
+      return ReverseScalar(val, index);
+    }
+
+    const ScalarType& value() const { return val_; }
+    ScalarType& value() { return val_; }
+
+    /** \brief The index on the tape, constants have the index -1 */
+    int index() const { return index_; }
+
+    /** \brief The derivatives w.r.t. all independent variables, see ReverseTape::gradient() */
+    std::span<const ScalarType> gradient() const { return reverseTape<ScalarType>().gradient(index_); }
+
+    explicit operator ScalarType() const { return val_; }
+
+    /** \brief The result of an outer function g with the derivative dg at the value of this number */
+    ReverseScalar compose(const ScalarType& g, const ScalarType& dg) const {
+      return ReverseScalar(g, record(*this, dg));
+    }
+
+    ReverseScalar& operator+=(const ReverseScalar& b) { return *this = *this + b; }
+    ReverseScalar& operator-=(const ReverseScalar& b) { return *this = *this - b; }
+    ReverseScalar& operator*=(const ReverseScalar& b) { return *this = *this * b; }
+    ReverseScalar& operator/=(const ReverseScalar& b) { return *this = *this / b; }
+
+    ReverseScalar operator-() const { return compose(-val_, ScalarType(-1)); }
+    ReverseScalar operator+() const { return *this; }
+
+    friend ReverseScalar operator+(const ReverseScalar& a, const ReverseScalar& b) {
+      return ReverseScalar(a.val_ + b.val_, record(a, ScalarType(1), b, ScalarType(1)));
+    }
+
+    friend ReverseScalar operator-(const ReverseScalar& a, const ReverseScalar& b) {
+      return ReverseScalar(a.val_ - b.val_, record(a, ScalarType(1), b, ScalarType(-1)));
+    }
+
+    friend ReverseScalar operator*(const ReverseScalar& a, const ReverseScalar& b) {
+      return ReverseScalar(a.val_ * b.val_, record(a, b.val_, b, a.val_));
+    }
+
+    friend ReverseScalar operator/(const ReverseScalar& a, const ReverseScalar& b) {
+      const ScalarType inv = ScalarType(1) / b.val_;
+      const ScalarType res = a.val_ * inv;
+      return ReverseScalar(res, record(a, inv, b, -res * inv));
+    }
+
+    /* Numbers are converted to the ScalarType, which avoids ambiguous conversions if it is not arithmetic */
+    template <typename Number>
+      requires std::is_arithmetic_v<Number>
+    friend ReverseScalar operator+(const ReverseScalar& a, const Number& b) {
+      return a + ReverseScalar(ScalarType(b));
+    }
+    template <typename Number>
+      requires std::is_arithmetic_v<Number>
+    friend ReverseScalar operator+(const Number& a, const ReverseScalar& b) {
+      return ReverseScalar(ScalarType(a)) + b;
+    }
+    template <typename Number>
+      requires std::is_arithmetic_v<Number>
+    friend ReverseScalar operator-(const ReverseScalar& a, const Number& b) {
+      return a - ReverseScalar(ScalarType(b));
+    }
+    template <typename Number>
+      requires std::is_arithmetic_v<Number>
+    friend ReverseScalar operator-(const Number& a, const ReverseScalar& b) {
+      return ReverseScalar(ScalarType(a)) - b;
+    }
+    template <typename Number>
+      requires std::is_arithmetic_v<Number>
+    friend ReverseScalar operator*(const ReverseScalar& a, const Number& b) {
+      return a * ReverseScalar(ScalarType(b));
+    }
+    template <typename Number>
+      requires std::is_arithmetic_v<Number>
+    friend ReverseScalar operator*(const Number& a, const ReverseScalar& b) {
+      return ReverseScalar(ScalarType(a)) * b;
+    }
+    template <typename Number>
+      requires std::is_arithmetic_v<Number>
+    friend ReverseScalar operator/(const ReverseScalar& a, const Number& b) {
+      return a / ReverseScalar(ScalarType(b));
+    }
+    template <typename Number>
+      requires std::is_arithmetic_v<Number>
+    friend ReverseScalar operator/(const Number& a, const ReverseScalar& b) {
+      return ReverseScalar(ScalarType(a)) / b;
+    }
+
+    /* Comparisons only consider the value, such that branches can be evaluated */
+    friend bool operator==(const ReverseScalar& a, const ReverseScalar& b) { return a.val_ == b.val_; }
+    friend bool operator!=(const ReverseScalar& a, const ReverseScalar& b) { return a.val_ != b.val_; }
+    friend bool operator<(const ReverseScalar& a, const ReverseScalar& b) { return a.val_ < b.val_; }
+    friend bool operator>(const ReverseScalar& a, const ReverseScalar& b) { return a.val_ > b.val_; }
+    friend bool operator<=(const ReverseScalar& a, const ReverseScalar& b) { return a.val_ <= b.val_; }
+    friend bool operator>=(const ReverseScalar& a, const ReverseScalar& b) { return a.val_ >= b.val_; }
+
+    friend std::ostream& operator<<(std::ostream& s, const ReverseScalar& a) { return s << a.val_; }
+
+  private:
+    ReverseScalar(const ScalarType& val, int index) : val_{val}, index_{index} {}
+
+    /* Records the operation on the tape if it depends on a variable, i.e. if not all arguments are constants */
+    static int record(const ReverseScalar& a, const ScalarType& da, const ReverseScalar& b = ReverseScalar(),
+                      const ScalarType& db = ScalarType(0)) {
+      if (a.index_ < 0 and b.index_ < 0) return -1;
+      return reverseTape<ScalarType>().record(a.index_, da, b.index_, db);
+    }
+
+    ScalarType val_;
+    int index_{-1};
+  };
+
+  template <typename ScalarType>
+  struct IsNumber<ReverseScalar<ScalarType>> : public std::true_type {};
+
+  template <typename ScalarType>
+  const ScalarType& val(const ReverseScalar<ScalarType>& a) {
+    return a.value();
+  }
+
+  template <typename ScalarType>
+  ReverseScalar<ScalarType> exp(const ReverseScalar<ScalarType>& a) {
+    using std::exp;
+    const ScalarType e = exp(a.value());
+    return a.compose(e, e);
+  }
+
+  template <typename ScalarType>
+  ReverseScalar<ScalarType> log(const ReverseScalar<ScalarType>& a) {
+    using std::log;
+    return a.compose(log(a.value()), ScalarType(1) / a.value());
+  }
+
+  template <typename ScalarType>
+  ReverseScalar<ScalarType> sqrt(const ReverseScalar<ScalarType>& a) {
+    using std::sqrt;
+    const ScalarType s = sqrt(a.value());
+    return a.compose(s, ScalarType(0.5) / s);
+  }
+
+  template <typename ScalarType, typename Number>
+    requires std::is_arithmetic_v<Number>
+  ReverseScalar<ScalarType> pow(const ReverseScalar<ScalarType>& a, const Number& p) {
+    using std::pow;
+    const ScalarType q = ScalarType(p);
+    return a.compose(pow(a.value(), q), q * pow(a.value(), q - ScalarType(1)));
+  }
+
+  template <typename ScalarType>
+  ReverseScalar<ScalarType> sin(const ReverseScalar<ScalarType>& a) {
+    using std::cos;
+    using std::sin;
+    return a.compose(sin(a.value()), cos(a.value()));
+  }
+
+  template <typename ScalarType>
+  ReverseScalar<ScalarType> cos(const ReverseScalar<ScalarType>& a) {
+    using std::cos;
+    using std::sin;
+    return a.compose(cos(a.value()), -sin(a.value()));
+  }
+
+  template <typename ScalarType>
+  ReverseScalar<ScalarType> tanh(const ReverseScalar<ScalarType>& a) {
+    using std::tanh;
+    const ScalarType t = tanh(a.value());
+    return a.compose(t, ScalarType(1) - t * t);
+  }
+
+  template <typename ScalarType>
+  ReverseScalar<ScalarType> abs(const ReverseScalar<ScalarType>& a) {
+    return a.value() < ScalarType(0) ? -a : a;
+  }
+
+}  // namespace Dune
+
+namespace Eigen {
+  template <typename ScalarType>
+  struct NumTraits<Dune::ReverseScalar<ScalarType>> : NumTraits<double> {
+    using Real       = Dune::ReverseScalar<ScalarType>;
+    using NonInteger = Dune::ReverseScalar<ScalarType>;
+    using Nested     = Dune::ReverseScalar<ScalarType>;
+    using Literal    = Dune::ReverseScalar<ScalarType>;
+    enum {
+      IsComplex             = 0,
+      IsInteger             = 0,
+      IsSigned              = 1,
+      RequireInitialization = 1,
+      ReadCost              = 1,
+      AddCost               = 2,
+      MulCost               = 2
+    };
+  };
+
+  template <typename ScalarType, typename BinaryOp>
+  struct ScalarBinaryOpTraits<Dune::ReverseScalar<ScalarType>, ScalarType, BinaryOp> {
+    using ReturnType = Dune::ReverseScalar<ScalarType>;
+  };
+
+  template <typename ScalarType, typename BinaryOp>
+  struct ScalarBinaryOpTraits<ScalarType, Dune::ReverseScalar<ScalarType>, BinaryOp> {
+    using ReturnType = Dune::ReverseScalar<ScalarType>;
+  };
+}  // namespace Eigen
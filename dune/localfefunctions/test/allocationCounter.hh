@@ -0,0 +1,81 @@
+// SPDX-FileCopyrightText: 2022 The dune-localfefunction developers mueller@ibb.uni-stuttgart.de
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#pragma once
+
+#include <cerrno>
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+/*
+ * Allocation counting harness. Every heap allocation of the program is routed through the functions below. While
+ * counting is enabled the number of allocations is recorded, such that evaluations of local functions can be checked
+ * to be free of heap allocations.
+ * Eigen allocates with std::malloc and not with operator new, therefore on glibc malloc itself is hooked. On other
+ * platforms only the global operator new is replaced.
+ * Since the replacements are no inline functions, this header may only be included by one translation unit of a
+ * program, e.g. by the allocation test or a benchmark.
+ */
+namespace AllocationCounter {
+  inline thread_local bool counting{false};
+  inline thread_local std::size_t allocations{0};
+
+  inline void count() {
+    if (counting) ++allocations;
+  }
+
+  /* Counts the heap allocations of the passed callable */
+  template <typename F>
+  std::size_t countAllocations(F&& f) {
+    allocations = 0;
+    counting    = true;
+    f();
+    counting = false;
+    return allocations;
+  }
+}  // namespace AllocationCounter
+
+#if defined(__GLIBC__)
+extern "C" {
+void* __libc_malloc(std::size_t);
+void* __libc_calloc(std::size_t, std::size_t);
+void* __libc_realloc(void*, std::size_t);
+void* __libc_memalign(std::size_t, std::size_t);
+
+void* malloc(std::size_t size) {
+  AllocationCounter::count();
+  return __libc_malloc(size);
+}
+
+void* calloc(std::size_t n, std::size_t size) {
+  AllocationCounter::count();
+  return __libc_calloc(n, size);
+}
+
+void* realloc(void* ptr, std::size_t size) {
+  AllocationCounter::count();
+  return __libc_realloc(ptr, size);
+}
+
+void* aligned_alloc(std::size_t alignment, std::size_t size) {
+  AllocationCounter::count();
+  return __libc_memalign(alignment, size);
+}
+
+int posix_memalign(void** ptr, std::size_t alignment, std::size_t size) {
+  AllocationCounter::count();
+  *ptr = __libc_memalign(alignment, size);
+  return *ptr ? 0 : ENOMEM;
+}
+}
+#else
+void* operator new(std::size_t size) {
+  AllocationCounter::count();
+  if (void* ptr = std::malloc(size)) return ptr;
+  throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept { std::free(ptr); }
+void operator delete(void* ptr, std::size_t) noexcept { std::free(ptr); }
+#endif
@@ -0,0 +1,206 @@
+// SPDX-FileCopyrightText: 2022 The dune-localfefunction developers mueller@ibb.uni-stuttgart.de
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <config.h>
+
+#include "allocationCounter.hh"
+#include "testexpression.hh"
+
+#include <dune/localfefunctions/expressions.hh>
+#include <dune/localfefunctions/manifolds/realTuple.hh>
+#include <dune/localfefunctions/manifolds/unitVector.hh>
+
+template <typename T>
+void doNotOptimizeAway(const T& value) {
+  asm volatile("" : : "g"(&value) : "memory");
+}
+
+/*
+ * Evaluates the local function and all its derivatives at all integration points. The first sweep over the
+ * integration points is not counted since the coordinate based evaluation fills internal buffers of the basis.
+ * Afterwards all evaluations must not allocate.
+ */
+template <typename LF>
+TestSuite checkNoAllocations(const LF& lf) {
+  TestSuite t("NoAllocations " + Dune::localFunctionName(lf));
+  using namespace Dune;
+  using namespace Dune::DerivativeDirections;
+  const auto& coeffs                   = lf.node().coefficientsRef();
+  const size_t coeffSize               = coeffs.size();
+  constexpr int gridDim                = LF::gridDim;
+  constexpr int localFunctionValueSize = LF::Traits::valueSize;
+  const auto alongVec                  = createOnesVector<double, localFunctionValueSize>();
+  const auto alongMat                  = createOnesMatrix<double, localFunctionValueSize, gridDim>();
+
+  /* Some expressions do not implement spatial derivatives and throw, this is checked before counting */
+  bool spatialImplemented = true;
+  try {
+    doNotOptimizeAway(lf.evaluateDerivative(0, wrt(spatialAll), on(gridElement)));
+  } catch (const Dune::NotImplemented&) {
+    spatialImplemented = false;
+  }
+
+  auto evaluateAll = [&](const auto& ipIndexOrPosition) {
+    doNotOptimizeAway(lf.evaluate(ipIndexOrPosition, on(referenceElement)));
+    doNotOptimizeAway(lf.evaluate(ipIndexOrPosition, on(gridElement)));
+    if (spatialImplemented) {
+      doNotOptimizeAway(lf.evaluateDerivative(ipIndexOrPosition, wrt(spatialAll), on(referenceElement)));
+      doNotOptimizeAway(lf.evaluateDerivative(ipIndexOrPosition, wrt(spatialAll), on(gridElement)));
+      for (int d = 0; d < gridDim; ++d)
+        doNotOptimizeAway(lf.evaluateDerivative(ipIndexOrPosition, wrt(spatial(d)), on(gridElement)));
+    }
+    for (size_t i = 0; i < coeffSize; ++i) {
+      doNotOptimizeAway(lf.evaluateDerivative(ipIndexOrPosition, wrt(coeff(i)), on(gridElement)));
+      if (spatialImplemented) {
+        doNotOptimizeAway(lf.evaluateDerivative(ipIndexOrPosition, wrt(coeff(i), spatialAll), on(gridElement)));
+        doNotOptimizeAway(lf.evaluateDerivative(ipIndexOrPosition, wrt(spatialAll, coeff(i)), on(gridElement)));
+        for (int d = 0; d < gridDim; ++d) {
+          doNotOptimizeAway(lf.evaluateDerivative(ipIndexOrPosition, wrt(coeff(i), spatial(d)), on(gridElement)));
+          doNotOptimizeAway(lf.evaluateDerivative(ipIndexOrPosition, wrt(spatial(d), coeff(i)), on(gridElement)));
+        }
+      }
+      for (size_t j = 0; j < coeffSize; ++j) {
+        doNotOptimizeAway(lf.evaluateDerivative(ipIndexOrPosition, wrt(coeff(i, j)), along(alongVec), on(gridElement)));
+        if (spatialImplemented) {
+          doNotOptimizeAway(lf.evaluateDerivative(ipIndexOrPosition, wrt(coeff(i, j), spatialAll), along(alongMat),
+                                                  on(gridElement)));
+          for (int d = 0; d < gridDim; ++d)
+            doNotOptimizeAway(lf.evaluateDerivative(ipIndexOrPosition, wrt(coeff(i, j), spatial(d)), along(alongVec),
+                                                    on(gridElement)));
+        }
+      }
+    }
+  };
+
+  for (const auto& [ipIndex, ip] : lf.viewOverIntegrationPoints())
+    evaluateAll(ip.position());
+
+  const std::size_t ipAllocations = AllocationCounter::countAllocations([&]() {
+    for (const auto& [ipIndex, ip] : lf.viewOverIntegrationPoints())
+      evaluateAll(ipIndex);
+  });
+  t.check(ipAllocations == 0, "Evaluation with integration point index does not allocate")
+      << ipAllocations << " heap allocations detected";
+
+  const std::size_t coordAllocations = AllocationCounter::countAllocations([&]() {
+    for (const auto& [ipIndex, ip] : lf.viewOverIntegrationPoints())
+      evaluateAll(ip.position());
+  });
+  t.check(coordAllocations == 0, "Evaluation with local coordinate does not allocate")
+      << coordAllocations << " heap allocations detected";
+
+  /* Only the first rebind creates the clone with dual numbers, later ones assign the coefficients to it */
+  doNotOptimizeAway(reusableRebindClone(lf, autodiff::dual2nd()));
+  const std::size_t rebindAllocations = AllocationCounter::countAllocations(
+      [&]() { doNotOptimizeAway(reusableRebindClone(lf, autodiff::dual2nd())); });
+  t.check(rebindAllocations == 0, "Reusing the rebound clone does not allocate")
+      << rebindAllocations << " heap allocations detected";
+  const auto& lfDual2nd = reusableRebindClone(lf, autodiff::dual2nd());
+  for (const auto& [ipIndex, ip] : lf.viewOverIntegrationPoints()) {
+    const auto value     = lf.evaluate(ipIndex, on(referenceElement));
+    const auto valueDual = lfDual2nd.evaluate(ipIndex, on(referenceElement));
+    for (int k = 0; k < localFunctionValueSize; ++k)
+      t.check(Dune::FloatCmp::eq(coeff(value, k, 0), autodiff::val(coeff(valueDual, k, 0))),
+              "Check value of the reused rebound clone");
+  }
+  return t;
+}
+
+template <int dim>
+using RealT = Dune::RealTuple<double, dim>;
+template <int dim>
+using UnitT = Dune::UnitVector<double, dim>;
+
+auto testAllocationFreeSingleFunction() {
+  TestSuite t;
+  using namespace Dune;
+  using namespace Dune::Indices;
+
+  auto expr = [](auto& f) { return sqrt(normSquared(f)) + 2.0 * normSquared(-f); };
+
+  auto exprTest = [](auto& h, auto&, [[maybe_unused]] auto& fe) { return checkNoAllocations(h); };
+
+  using Expr        = decltype(expr);
+  using ExprTest    = decltype(exprTest);
+  using ManiFoldIDP = ManiFoldTemplateIDPair<RealT, _0>;
+  using FC          = decltype(singleStandardLocalFunction);
+
+  t.subTest(testExpressionsOnLine<Expr, ExprTest, FC, false, ManiFoldIDP>(expr, exprTest, singleStandardLocalFunction));
+  t.subTest(
+      testExpressionsOnTriangle<Expr, ExprTest, FC, false, ManiFoldIDP>(expr, exprTest, singleStandardLocalFunction));
+  t.subTest(testExpressionsOnQuadrilateral<Expr, ExprTest, FC, false, ManiFoldIDP>(expr, exprTest,
+                                                                                   singleStandardLocalFunction));
+  t.subTest(
+      testExpressionsOnHexahedron<Expr, ExprTest, FC, false, ManiFoldIDP>(expr, exprTest, singleStandardLocalFunction));
+  return t;
+}
+
+auto testAllocationFreeTwoFunctions() {
+  TestSuite t;
+  using namespace Dune;
+  using namespace Dune::Indices;
+
+  auto expr = [](auto& f, auto& g) { return log(dot(f, g) + 10.0 * normSquared(f)) + pow<3>(dot(f + g, g)); };
+
+  auto exprTest = [](auto& h, auto&, auto&, [[maybe_unused]] auto& fe) { return checkNoAllocations(h); };
+
+  using Expr        = decltype(expr);
+  using ExprTest    = decltype(exprTest);
+  using ManiFoldIDP = ManiFoldTemplateIDPair<RealT, _0>;
+  using FC          = decltype(doubleStandardLocalFunctionDouble);
+
+  t.subTest(testExpressionsOnTriangle<Expr, ExprTest, FC, false, ManiFoldIDP, ManiFoldIDP>(
+      expr, exprTest, doubleStandardLocalFunctionDouble));
+  t.subTest(testExpressionsOnHexahedron<Expr, ExprTest, FC, false, ManiFoldIDP, ManiFoldIDP>(
+      expr, exprTest, doubleStandardLocalFunctionDouble));
+  return t;
+}
+
+auto testAllocationFreeStrains() {
+  TestSuite t;
+  using namespace Dune;
+  using namespace Dune::Indices;
+
+  auto expr     = [](auto& f) { return greenLagrangeStrains(f) + linearStrains(f); };
+  auto exprTest = [](auto& h, auto&, [[maybe_unused]] auto& fe) { return checkNoAllocations(h); };
+
+  using Expr        = decltype(expr);
+  using ExprTest    = decltype(exprTest);
+  using ManiFoldIDP = ManiFoldTemplateIDPair<RealT, _0>;
+  using FC          = decltype(singleStandardLocalFunction);
+
+  t.subTest(testExpressionsOnCustomGeometry<2, 2, 2, Expr, ExprTest, FC, false, ManiFoldIDP>(
+      Dune::GeometryTypes::quadrilateral, expr, exprTest, singleStandardLocalFunction));
+  t.subTest(testExpressionsOnCustomGeometry<3, 1, 3, Expr, ExprTest, FC, false, ManiFoldIDP>(
+      Dune::GeometryTypes::hexahedron, expr, exprTest, singleStandardLocalFunction));
+  return t;
+}
+
+auto testAllocationFreeProjectionBased() {
+  TestSuite t;
+  using namespace Dune;
+  using namespace Dune::Indices;
+
+  auto expr     = [](auto& f) { return f; };
+  auto exprTest = [](auto& h, auto&, [[maybe_unused]] auto& fe) { return checkNoAllocations(h); };
+
+  using Expr        = decltype(expr);
+  using ExprTest    = decltype(exprTest);
+  using ManiFoldIDP = ManiFoldTemplateIDPair<UnitT, _0>;
+  using FC          = decltype(singleProjectionBasedLocalFunction);
+
+  t.subTest(testExpressionsOnCustomGeometry<2, 2, 3, Expr, ExprTest, FC, false, ManiFoldIDP>(
+      Dune::GeometryTypes::quadrilateral, expr, exprTest, singleProjectionBasedLocalFunction));
+  return t;
+}
+
+int main(int argc, char** argv) {
+  Dune::MPIHelper::instance(argc, argv);
+  TestSuite t;
+
+  t.subTest(testAllocationFreeSingleFunction());
+  t.subTest(testAllocationFreeTwoFunctions());
+  t.subTest(testAllocationFreeStrains());
+  t.subTest(testAllocationFreeProjectionBased());
+  return t.exit();
+}
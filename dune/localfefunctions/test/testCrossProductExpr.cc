@@ -0,0 +1,115 @@
+// SPDX-FileCopyrightText: 2022 The dune-localfefunction developers mueller@ibb.uni-stuttgart.de
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <config.h>
+
+#include "testexpression.hh"
+
+#include <dune/localfefunctions/expressions.hh>
+#include <dune/localfefunctions/manifolds/realTuple.hh>
+#include <dune/localfefunctions/manifolds/unitVector.hh>
+
+template <int dim>
+using RealT = Dune::RealTuple<double, dim>;
+
+template <int dim>
+using UnitT = Dune::UnitVector<double, dim>;
+
+auto directorAndStandardLocalFunction = [](auto& localBasis0, auto& vBlockedLocal0, auto&& ID0, auto& localBasis1,
+                                           auto& vBlockedLocal1, auto&& ID1, auto& geometry) {
+  auto d = Dune::ProjectionBasedLocalFunction(localBasis0, vBlockedLocal0, geometry, ID0);
+  auto g = Dune::StandardLocalFunction(localBasis1, vBlockedLocal1, geometry, ID1);
+  return std::make_tuple(d, g);
+};
+
+auto crossExprTest = [](auto& h, auto&, auto&, [[maybe_unused]] auto& fe) {
+  TestSuite tL("crossExprTests");
+  using namespace Dune;
+  using namespace Dune::DerivativeDirections;
+  using HRawType = std::remove_cvref_t<decltype(h)>;
+  static_assert(HRawType::valueSize == 3);
+
+  for (auto [gpIndex, gp] : h.viewOverIntegrationPoints()) {
+    const auto u = toEigen(h.l().evaluate(gpIndex, on(gridElement)));
+    const auto v = toEigen(h.r().evaluate(gpIndex, on(gridElement)));
+    const auto w = toEigen(h.evaluate(gpIndex, on(gridElement)));
+    tL.check(isApproxSame(u.cross(v).eval(), w, 1e-14), "Check value of cross product");
+    tL.check(std::abs(w.dot(u)) < 1e-12 and std::abs(w.dot(v)) < 1e-12, "Check orthogonality of cross product");
+  }
+  return tL;
+};
+
+auto testCross() {
+  TestSuite t;
+  using namespace Dune;
+  using namespace Dune::Indices;
+
+  auto expr = [](auto& f, auto& g) {
+    static_assert(std::remove_cvref_t<decltype(cross(f, g))>::order() == quadratic);
+    return cross(f + g, 2.0 * g);
+  };
+
+  using ManiFoldIDP0 = ManiFoldTemplateIDPair<RealT, _0>;
+
+  using Expr     = decltype(expr);
+  using ExprTest = decltype(crossExprTest);
+  using FC       = decltype(doubleStandardLocalFunctionDistinct);
+  t.subTest(testExpressionsOnCustomGeometry<2, 1, 3, Expr, ExprTest, FC, true, ManiFoldIDP0, ManiFoldIDP0>(
+      Dune::GeometryTypes::quadrilateral, expr, crossExprTest, doubleStandardLocalFunctionDistinct));
+  t.subTest(testExpressionsOnCustomGeometry<2, 2, 3, Expr, ExprTest, FC, true, ManiFoldIDP0, ManiFoldIDP0>(
+      Dune::GeometryTypes::quadrilateral, expr, crossExprTest, doubleStandardLocalFunctionDistinct));
+  t.subTest(testExpressionsOnCustomGeometry<3, 1, 3, Expr, ExprTest, FC, true, ManiFoldIDP0, ManiFoldIDP0>(
+      Dune::GeometryTypes::hexahedron, expr, crossExprTest, doubleStandardLocalFunctionDistinct));
+  t.subTest(testExpressionsOnCustomGeometry<3, 2, 3, Expr, ExprTest, FC, true, ManiFoldIDP0, ManiFoldIDP0>(
+      Dune::GeometryTypes::hexahedron, expr, crossExprTest, doubleStandardLocalFunctionDistinct));
+  return t;
+}
+
+auto testCrossWithDirector() {
+  TestSuite t;
+  using namespace Dune;
+  using namespace Dune::Indices;
+
+  auto expr = [](auto& d, auto& g) { return cross(d, g); };
+
+  // The director d and the displacements g have different coefficients, thus only the derivatives w.r.t. the director
+  // coefficients are compared to the derivatives of the director, since the default tests assume a single set of
+  // coefficients
+  auto exprTest = [](auto& h, auto& vBlockedLocal0, auto& vBlockedLocal1, auto& fe) {
+    TestSuite tL("crossWithDirectorTests");
+    tL.subTest(crossExprTest(h, vBlockedLocal0, vBlockedLocal1, fe));
+    using namespace Dune::DerivativeDirections;
+    for (auto [gpIndex, gp] : h.viewOverIntegrationPoints()) {
+      const auto g = toEigen(h.r().evaluate(gpIndex, on(gridElement)));
+      for (size_t i = 0; i < vBlockedLocal0.size(); ++i) {
+        const auto dwdI = toEigen(h.evaluateDerivative(gpIndex, wrt(coeff(_0, i)), on(gridElement)));
+        const auto dddI = toEigen(h.l().evaluateDerivative(gpIndex, wrt(coeff(_0, i)), on(gridElement)));
+        for (int k = 0; k < dddI.cols(); ++k)
+          tL.check(isApproxSame(dddI.col(k).cross(g).eval(), dwdI.col(k).eval(), 1e-14),
+                   "Check derivative w.r.t. director coefficients");
+      }
+    }
+    return tL;
+  };
+
+  using ManiFoldIDP0 = ManiFoldTemplateIDPair<UnitT, _0>;
+  using ManiFoldIDP1 = ManiFoldTemplateIDPair<RealT, _1>;
+
+  using Expr     = decltype(expr);
+  using ExprTest = decltype(exprTest);
+  using FC       = decltype(directorAndStandardLocalFunction);
+  t.subTest(testExpressionsOnCustomGeometry<2, 2, 3, Expr, ExprTest, FC, false, ManiFoldIDP0, ManiFoldIDP1>(
+      Dune::GeometryTypes::quadrilateral, expr, exprTest, directorAndStandardLocalFunction));
+  t.subTest(testExpressionsOnCustomGeometry<3, 1, 3, Expr, ExprTest, FC, false, ManiFoldIDP0, ManiFoldIDP1>(
+      Dune::GeometryTypes::hexahedron, expr, exprTest, directorAndStandardLocalFunction));
+  return t;
+}
+
+int main(int argc, char** argv) {
+  Dune::MPIHelper::instance(argc, argv);
+  TestSuite t;
+
+  t.subTest(testCross());
+  t.subTest(testCrossWithDirector());
+  return t.exit();
+}
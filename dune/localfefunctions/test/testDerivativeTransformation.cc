@@ -160,6 +160,54 @@ auto testTransformation() {
   return t;
 }
 
+/* Leaf nodes with the same basis and geometry inside one expression should transform their derivatives only once */
+template <typename Manifold, int gridDim, int order>
+auto testSharedTransformation(const Dune::GeometryType& geometryType) {
+  TestSuite t("testSharedTransformation, gridDim: " + std::to_string(gridDim));
+  using namespace Dune::DerivativeDirections;
+  auto [f, nodalPoints, geometry, corners, feCache]
+      = Testing::localFunctionTestConstructorNew<Manifold, gridDim, gridDim, order>(geometryType);
+  auto g = f.clone();
+  t.check(f.transformedDerivatives() != g.transformedDerivatives(), "Clones start with their own transformation");
+  auto fCopy = f;
+  t.check(f.transformedDerivatives() != fCopy.transformedDerivatives(), "Copies have their own transformation");
+
+  auto h = f + g;
+  t.check(f.transformedDerivatives() != g.transformedDerivatives(), "Building an expression leaves lvalues untouched");
+
+  auto hOwned = f.clone() + g.clone();
+  t.check(hOwned.l().transformedDerivatives() == hOwned.r().transformedDerivatives(),
+          "Owned leaf nodes of the sum share the transformation");
+  auto hOwnedCopy = hOwned;
+  t.check(hOwnedCopy.l().transformedDerivatives() != hOwned.l().transformedDerivatives(),
+          "Copies of an expression do not share the transformation with the original");
+
+  // A moved-from leaf node has no transformation, copying it must not access it
+  auto fOwned         = f.clone();
+  auto fMoved         = std::move(fOwned);
+  auto fMovedFromCopy = fOwned;
+  t.check(fMoved.transformedDerivatives() != fMovedFromCopy.transformedDerivatives(),
+          "Copies of a moved-from leaf node do not share the transformation of the moved one");
+
+  Dune::shareDerivativeTransformations(f, g);
+  t.check(f.transformedDerivatives() == g.transformedDerivatives(), "Explicit sharing of caller-held leaf nodes");
+
+  auto rebound = f.basis();
+  rebound.bind(Dune::QuadratureRules<double, gridDim>::rule(geometryType, 2 * order), Dune::bindDerivatives(0, 1));
+  t.check(rebound.bindingId() != f.basis().bindingId() and not(rebound == f.basis()),
+          "Each binding of a basis has its own identity");
+
+  for (auto [gpIndex, gp] : f.viewOverIntegrationPoints()) {
+    auto JExpected = Dune::eval(f.evaluateDerivative(gpIndex, Dune::wrt(spatialAll), Dune::on(gridElement)));
+    JExpected *= 2.0;
+    const auto Jh      = h.evaluateDerivative(gpIndex, Dune::wrt(spatialAll), Dune::on(gridElement));
+    const auto JhOwned = hOwned.evaluateDerivative(gpIndex, Dune::wrt(spatialAll), Dune::on(gridElement));
+    t.check(isApproxSame(Dune::eval(Jh), JExpected, 1e-14), "Shared transformation yields the same derivatives");
+    t.check(isApproxSame(Dune::eval(JhOwned), JExpected, 1e-14), "Shared transformation yields the same derivatives");
+  }
+  return t;
+}
+
 int main(int argc, char** argv) {
   Dune::MPIHelper::instance(argc, argv);
   TestSuite t;
@@ -180,4 +228,8 @@ int main(int argc, char** argv) {
 
   t.subTest(testTransformation<Manifold5>());
   t.subTest(testTransformation<Manifold6>());
+
+  using namespace Dune::GeometryTypes;
+  t.subTest(testSharedTransformation<Manifold, 2, 1>(quadrilateral));
+  t.subTest(testSharedTransformation<Manifold5, 3, 2>(hexahedron));
 }
@@ -0,0 +1,102 @@
+// SPDX-FileCopyrightText: 2022 The dune-localfefunction developers mueller@ibb.uni-stuttgart.de
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <config.h>
+
+// The profiler is enabled for this test only, such that the other tests stay uninstrumented
+#ifndef DUNE_LOCALFEFUNCTIONS_ENABLE_PROFILING
+#  define DUNE_LOCALFEFUNCTIONS_ENABLE_PROFILING 1
+#endif
+
+#include "testexpression.hh"
+
+#include <sstream>
+
+#include <dune/localfefunctions/evaluationProfiler.hh>
+#include <dune/localfefunctions/expressions.hh>
+#include <dune/localfefunctions/manifolds/realTuple.hh>
+
+template <int dim>
+using RealT = Dune::RealTuple<double, dim>;
+
+/* Sums the statistics of all entries of the node and the signature, since there is an entry for each transformation
+ * and type of integration point */
+Dune::EvaluationProfileEntry accumulatedEntry(const std::string& node, const std::string& signature) {
+  Dune::EvaluationProfileEntry sum{node, signature};
+  for (const auto& entry : Dune::evaluationProfile().entries())
+    if (entry.node == node and entry.signature == signature) {
+      sum.isLeaf = entry.isLeaf;
+      sum.calls += entry.calls;
+      sum.evaluations += entry.evaluations;
+      sum.time += entry.time;
+    }
+  return sum;
+}
+
+auto testEvaluationProfiler() {
+  TestSuite t;
+  using namespace Dune;
+  using namespace Dune::Indices;
+
+  auto expr = [](auto& f, auto& g) { return dot(f, g); };
+
+  auto exprTest = [](auto& h, auto&, auto&, [[maybe_unused]] auto& fe) {
+    TestSuite tL("EvaluationProfilerTests");
+    using namespace Dune::DerivativeDirections;
+    const std::string rootName(expressionDescription<decltype(h)>());
+    const std::string leafName(expressionDescription<decltype(h.l())>());
+    std::size_t ipCount = 0;
+
+    evaluationProfile().reset();
+    for (auto [gpIndex, gp] : h.viewOverIntegrationPoints()) {
+      h.evaluate(gpIndex, on(gridElement));
+      ++ipCount;
+    }
+    const auto rootValue = accumulatedEntry(rootName, "value");
+    const auto leafValue = accumulatedEntry(leafName, "value");
+    tL.check(rootValue.calls == ipCount and rootValue.evaluations == ipCount and not rootValue.isLeaf,
+             "Check value calls of the root node")
+        << rootValue.calls << " calls and " << rootValue.evaluations << " evaluations";
+    // Both factors are of the same type and share their entry, each is evaluated once per integration point
+    tL.check(leafValue.calls == 2 * ipCount and leafValue.evaluations == 2 * ipCount and leafValue.isLeaf,
+             "Check value calls of the leaf nodes")
+        << leafValue.calls << " calls and " << leafValue.evaluations << " evaluations";
+
+    evaluationProfile().reset();
+    for (auto [gpIndex, gp] : h.viewOverIntegrationPoints())
+      h.evaluateDerivative(gpIndex, wrt(coeff(0)), on(gridElement));
+    const auto rootDerivative = accumulatedEntry(rootName, "d/(dcoeff)");
+    const auto leafDerivative = accumulatedEntry(leafName, "d/(dcoeff)");
+    tL.check(rootDerivative.calls == ipCount, "Check derivative calls of the root node") << rootDerivative.calls;
+    tL.check(leafDerivative.calls == 2 * ipCount, "Check derivative calls of the leaf nodes") << leafDerivative.calls;
+    tL.check(accumulatedEntry(rootName, "value").calls == 0, "Check reset of the profile");
+
+    std::stringstream csv, json;
+    evaluationProfile().writeCSV(csv);
+    evaluationProfile().writeJSON(json);
+    tL.check(csv.str().starts_with("node,signature,isLeaf,calls,evaluations,timeInNanoseconds\n"), "Check CSV header");
+    tL.check(csv.str().find("\"d/(dcoeff)\"") != std::string::npos, "Check CSV content");
+    tL.check(json.str().find("\"signature\": \"d/(dcoeff)\"") != std::string::npos, "Check JSON content");
+    return tL;
+  };
+
+  using ManiFoldIDP = ManiFoldTemplateIDPair<RealT, _0>;
+
+  using Expr     = decltype(expr);
+  using ExprTest = decltype(exprTest);
+  using FC       = decltype(doubleStandardLocalFunctionDouble);
+
+  t.subTest(testExpressionsOnTriangle<Expr, ExprTest, FC, false, ManiFoldIDP, ManiFoldIDP>(
+      expr, exprTest, doubleStandardLocalFunctionDouble));
+  t.subTest(testExpressionsOnHexahedron<Expr, ExprTest, FC, false, ManiFoldIDP, ManiFoldIDP>(
+      expr, exprTest, doubleStandardLocalFunctionDouble));
+  return t;
+}
+
+int main(int argc, char** argv) {
+  Dune::MPIHelper::instance(argc, argv);
+  TestSuite t;
+
+  t.subTest(testEvaluationProfiler());
+  return t.exit();
+}
@@ -0,0 +1,61 @@
+// SPDX-FileCopyrightText: 2022 The dune-localfefunction developers mueller@ibb.uni-stuttgart.de
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <config.h>
+
+#include <dune/common/classname.hh>
+#include <dune/common/parallel/mpihelper.hh>
+#include <dune/common/test/testsuite.hh>
+#include <dune/geometry/quadraturerules.hh>
+#include <dune/localfefunctions/cachedlocalBasis/cachedlocalBasis.hh>
+#include <dune/localfunctions/lagrange/lagrangecube.hh>
+#include <dune/localfunctions/lagrange/lagrangesimplex.hh>
+
+using Dune::TestSuite;
+
+/*
+ * Links the library dune-localfefunctions. The cached Lagrange bases are only declared extern in this translation unit,
+ * thus bind() and the evaluations of the Dune basis are taken from the explicit instantiations of the library, see
+ * cachedlocalBasisInstantiations.hh.
+ */
+#if DUNE_LOCALFEFUNCTIONS_EXPLICIT_INSTANTIATIONS != 1
+#  error "The library dune-localfefunctions does not export DUNE_LOCALFEFUNCTIONS_EXPLICIT_INSTANTIATIONS."
+#endif
+#ifndef DUNE_LOCALFEFUNCTIONS_LIBRARY_USE_EIGEN
+#  error "The library dune-localfefunctions does not export its linear algebra backend."
+#endif
+
+template <typename DuneBasis>
+auto testInstantiatedBasis(const Dune::GeometryType& type) {
+  TestSuite t(Dune::className<DuneBasis>());
+  constexpr int gridDim = DuneBasis::Traits::dimDomain;
+  const DuneBasis duneBasis;
+  std::vector<typename DuneBasis::Traits::RangeType> NDune;
+
+  Dune::CachedLocalBasis basis(duneBasis);
+  basis.bind(Dune::QuadratureRules<double, gridDim>::rule(type, 2), Dune::bindDerivatives(0, 1));
+  for (const auto& [gpIndex, gp] : basis.viewOverIntegrationPoints()) {
+    duneBasis.evaluateFunction(gp.position(), NDune);
+    const auto& N = basis.evaluateFunction(gpIndex);
+    typename Dune::CachedLocalBasis<DuneBasis>::AnsatzFunctionType NAtPosition;
+    basis.evaluateFunction(gp.position(), NAtPosition);
+    for (std::size_t i = 0; i < NDune.size(); ++i) {
+      t.check(std::abs(N[i] - NDune[i][0]) < 1e-14, "Check the bound shape functions");
+      t.check(std::abs(NAtPosition[i] - NDune[i][0]) < 1e-14, "Check the shape functions at a position");
+    }
+  }
+  return t;
+}
+
+int main(int argc, char** argv) {
+  Dune::MPIHelper::instance(argc, argv);
+  TestSuite t;
+  using namespace Dune;
+
+  t.subTest(testInstantiatedBasis<Impl::LagrangeCubeLocalBasis<double, double, 1, 2>>(GeometryTypes::line));
+  t.subTest(testInstantiatedBasis<Impl::LagrangeCubeLocalBasis<double, double, 2, 1>>(GeometryTypes::quadrilateral));
+  t.subTest(testInstantiatedBasis<Impl::LagrangeSimplexLocalBasis<double, double, 2, 2>>(GeometryTypes::triangle));
+  t.subTest(testInstantiatedBasis<Impl::LagrangeCubeLocalBasis<double, double, 3, 1>>(GeometryTypes::hexahedron));
+  t.subTest(testInstantiatedBasis<Impl::LagrangeSimplexLocalBasis<double, double, 3, 3>>(GeometryTypes::tetrahedron));
+  return t.exit();
+}
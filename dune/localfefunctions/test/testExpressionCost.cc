@@ -0,0 +1,119 @@
+// SPDX-FileCopyrightText: 2022 The dune-localfefunction developers mueller@ibb.uni-stuttgart.de
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <config.h>
+
+#include "testexpression.hh"
+
+#include <dune/localfefunctions/expressionCost.hh>
+#include <dune/localfefunctions/expressions.hh>
+#include <dune/localfefunctions/manifolds/realTuple.hh>
+
+template <int dim>
+using RealT = Dune::RealTuple<double, dim>;
+
+auto testExpressionCost() {
+  TestSuite t;
+  using namespace Dune;
+  using namespace Dune::Indices;
+
+  auto expr = [](auto& f, auto& g) { return normSquared(f + g); };
+
+  auto exprTest = [](auto& h, auto& vBlockedLocal0, auto&, [[maybe_unused]] auto& fe) {
+    TestSuite tL("ExpressionCostTests");
+    using HRawType = std::remove_cvref_t<decltype(h)>;
+    using FRawType = std::remove_cvref_t<decltype(h.node(_0))>;
+    const int n    = static_cast<int>(vBlockedLocal0.size());
+
+    auto evaluations = [](const ExpressionCost& cost, std::size_t node, CostSignature signature) {
+      for (const auto& entry : cost.entries)
+        if (entry.node == node and entry.signature == signature) return entry.evaluations;
+      return 0;
+    };
+
+    // The nodes in pre-order are NormSquared, Sum, SLF and SLF
+    const auto value = expressionCost<HRawType>({0, false}, n);
+    tL.check(value.entries.size() == 4, "Check that the value evaluates each node once");
+    EvaluationCost sum;
+    for (const auto& entry : value.entries)
+      sum += entry.cost;
+    tL.check(sum.flops == value.total().flops and sum.bytes == value.total().bytes, "Check the aggregation");
+    tL.check(value.total().flops > 0 and value.total().bytes > 0, "Check positive cost");
+
+    const auto leafValue = expressionCost<FRawType>({0, false}, n);
+    tL.check(evaluations(leafValue, 0, {0, false}) == 1 and leafValue.entries.size() == 1, "Check the leaf node");
+    tL.check(expressionCost<FRawType>({0, false}, 2 * n).total().flops > leafValue.total().flops,
+             "Check that the cost of the interpolation grows with the number of ansatz functions");
+
+    // The second derivatives of the linear subexpressions vanish, but their first derivatives are needed w.r.t.
+    // both coefficients by the product rule
+    const auto hessian = expressionCost<HRawType>({2, false}, n);
+    tL.check(evaluations(hessian, 0, {2, false}) == 1, "Check the second derivative of the root");
+    tL.check(evaluations(hessian, 1, {2, false}) == 0, "Check that the vanishing second derivative is skipped");
+    tL.check(evaluations(hessian, 1, {1, false}) == 2, "Check the first derivatives w.r.t. both coefficients");
+    tL.check(evaluations(hessian, 1, {0, false}) == 1, "Check that the value is evaluated once");
+    for (std::size_t leaf : {2, 3}) {
+      tL.check(evaluations(hessian, leaf, {1, false}) == 2, "Check the first derivatives of the leaf nodes");
+      tL.check(evaluations(hessian, leaf, {2, false}) == 0, "Check the second derivatives of the leaf nodes");
+    }
+    tL.check(hessian.total().flops > value.total().flops, "Check that the second derivative is more expensive");
+
+    const auto spatial = expressionCost<HRawType>({1, true}, n);
+    tL.check(evaluations(spatial, 2, {0, true}) == 1 and evaluations(spatial, 2, {1, true}) == 1,
+             "Check the spatial derivatives requested by the product rule");
+    return tL;
+  };
+
+  using ManiFoldIDP = ManiFoldTemplateIDPair<RealT, _0>;
+
+  using Expr     = decltype(expr);
+  using ExprTest = decltype(exprTest);
+  using FC       = decltype(doubleStandardLocalFunctionDouble);
+
+  t.subTest(testExpressionsOnTriangle<Expr, ExprTest, FC, false, ManiFoldIDP, ManiFoldIDP>(
+      expr, exprTest, doubleStandardLocalFunctionDouble));
+  t.subTest(testExpressionsOnHexahedron<Expr, ExprTest, FC, false, ManiFoldIDP, ManiFoldIDP>(
+      expr, exprTest, doubleStandardLocalFunctionDouble));
+  return t;
+}
+
+auto testGreenLagrangeStrainsCost() {
+  TestSuite t;
+  using namespace Dune;
+  using namespace Dune::Indices;
+
+  auto expr = [](auto& f) { return greenLagrangeStrains(f); };
+
+  auto exprTest = [](auto& h, auto& vBlockedLocal, [[maybe_unused]] auto& fe) {
+    TestSuite tL("GreenLagrangeStrainsCostTests");
+    using HRawType = std::remove_cvref_t<decltype(h)>;
+    const int n    = static_cast<int>(vBlockedLocal.size());
+
+    // The strains only need the spatial derivatives of the displacements
+    const auto stiffness = expressionCost<HRawType>({2, false}, n);
+    for (const auto& entry : stiffness.entries)
+      if (entry.node == 1) tL.check(entry.signature.spatialAll, "Check that only spatial derivatives are requested");
+    tL.check(stiffness.total().arithmeticIntensity() > 0, "Check the arithmetic intensity");
+    return tL;
+  };
+
+  using ManiFoldIDP = ManiFoldTemplateIDPair<RealT, _0>;
+  using Expr        = decltype(expr);
+  using ExprTest    = decltype(exprTest);
+  using FC          = decltype(singleStandardLocalFunction);
+
+  t.subTest(testExpressionsOnQuadrilateral<Expr, ExprTest, FC, false, ManiFoldIDP>(expr, exprTest,
+                                                                                   singleStandardLocalFunction));
+  t.subTest(
+      testExpressionsOnHexahedron<Expr, ExprTest, FC, false, ManiFoldIDP>(expr, exprTest, singleStandardLocalFunction));
+  return t;
+}
+
+int main(int argc, char** argv) {
+  Dune::MPIHelper::instance(argc, argv);
+  TestSuite t;
+
+  t.subTest(testExpressionCost());
+  t.subTest(testGreenLagrangeStrainsCost());
+  return t.exit();
+}
@@ -0,0 +1,66 @@
+// SPDX-FileCopyrightText: 2022 The dune-localfefunction developers mueller@ibb.uni-stuttgart.de
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <config.h>
+
+#include "testexpression.hh"
+
+#include <dune/localfefunctions/expressionDescription.hh>
+#include <dune/localfefunctions/expressions.hh>
+#include <dune/localfefunctions/manifolds/realTuple.hh>
+
+template <int dim>
+using RealT = Dune::RealTuple<double, dim>;
+
+auto testExpressionDescription() {
+  TestSuite t;
+  using namespace Dune;
+  using namespace Dune::Indices;
+
+  auto expr = [](auto& f, auto& g) { return log(dot(f, g)) + 2.0 * normSquared(f); };
+
+  auto exprTest = [](auto& h, auto&, auto&, [[maybe_unused]] auto& fe) {
+    TestSuite tL("ExpressionDescriptionTests");
+    using HRawType = std::remove_cvref_t<decltype(h)>;
+    using FRawType = std::remove_cvref_t<decltype(h.node(_0))>;
+
+    constexpr std::string_view desc = expressionDescription<HRawType>();
+    static_assert(desc.starts_with("Sum<valueSize=1,order(0)=nonlinear>(Log<valueSize=1,order(0)=nonlinear>(Dot<"));
+    static_assert(desc.find("Scale<valueSize=1,order(0)=quadratic>(Constant<valueSize=1>,NormSquared<") != desc.npos);
+    constexpr int valueSize = FRawType::Traits::valueSize;
+    tL.check(desc.find("SLF<id=0,valueSize=" + std::to_string(valueSize) + ",order(0)=linear>") != desc.npos,
+             "Check description of the leaf nodes")
+        << desc;
+
+    // The description only depends on the type, thus a clone has the same description and the same hash
+    static_assert(expressionHash<HRawType>() == expressionHash<decltype(h.clone())>());
+    static_assert(expressionHash<HRawType>() != expressionHash<FRawType>());
+
+    std::vector<std::string_view> kinds;
+    forEachExpressionNode<HRawType>([&](auto node) { kinds.push_back(decltype(node)::kind); });
+    const std::vector<std::string_view> expectedKinds{"Sum",   "Log",      "Dot",         "SLF", "SLF",
+                                                      "Scale", "Constant", "NormSquared", "SLF"};
+    tL.check(kinds == expectedKinds, "Check depth-first traversal of the expression nodes");
+    return tL;
+  };
+
+  using ManiFoldIDP = ManiFoldTemplateIDPair<RealT, _0>;
+
+  using Expr     = decltype(expr);
+  using ExprTest = decltype(exprTest);
+  using FC       = decltype(doubleStandardLocalFunctionDouble);
+
+  t.subTest(testExpressionsOnTriangle<Expr, ExprTest, FC, false, ManiFoldIDP, ManiFoldIDP>(
+      expr, exprTest, doubleStandardLocalFunctionDouble));
+  t.subTest(testExpressionsOnHexahedron<Expr, ExprTest, FC, false, ManiFoldIDP, ManiFoldIDP>(
+      expr, exprTest, doubleStandardLocalFunctionDouble));
+  return t;
+}
+
+int main(int argc, char** argv) {
+  Dune::MPIHelper::instance(argc, argv);
+  TestSuite t;
+
+  t.subTest(testExpressionDescription());
+  return t.exit();
+}
@@ -49,6 +49,53 @@ auto testGreenLagrangianStrainExpr() {
   return t;
 }
 
+/*
+ * Checks that the B-operator and the geometric stiffness of the whole element coincide with the derivatives w.r.t.
+ * single coefficients and pairs of coefficients.
+ */
+template <int gridDim>
+auto testBOperatorAndGeometricStiffness(const Dune::GeometryType& geometryType) {
+  TestSuite t("testBOperatorAndGeometricStiffness, gridDim: " + std::to_string(gridDim));
+  using namespace Dune;
+  using namespace Dune::DerivativeDirections;
+  auto [f, nodalPoints, geometry, corners, feCache]
+      = Testing::localFunctionTestConstructorNew<RealT<gridDim>, gridDim, gridDim, 1>(geometryType);
+  auto strains = greenLagrangeStrains(f);
+
+  constexpr int strainSize     = decltype(strains)::strainSize;
+  const double tol             = 1e-13;
+  const std::size_t coeffsSize = f.coefficientsRef().size();
+  Eigen::Vector<double, strainSize> S;
+  for (int k = 0; k < strainSize; ++k)
+    S[k] = 1.0 + k;
+  Eigen::MatrixXd bop(strainSize, coeffsSize * gridDim);
+  Eigen::MatrixXd kg(coeffsSize * gridDim, coeffsSize * gridDim);
+
+  auto checkTransform = [&](const auto& transform, const std::string& name) {
+    for (auto [gpIndex, gp] : strains.viewOverIntegrationPoints()) {
+      strains.evaluateBOperatorAndGeometricStiffness(gpIndex, S, bop, kg, transform);
+      for (size_t i = 0; i < coeffsSize; ++i) {
+        const auto dEdi = strains.evaluateDerivative(gpIndex, wrt(coeff(i)), transform);
+        for (int r = 0; r < strainSize; ++r)
+          for (int c = 0; c < gridDim; ++c)
+            t.check(Dune::FloatCmp::eq(coeff(dEdi, r, c), bop(r, i * gridDim + c), tol),
+                    "Check B-operator on " + name);
+
+        for (size_t j = 0; j < coeffsSize; ++j) {
+          const auto dEdij = strains.evaluateDerivative(gpIndex, wrt(coeff(i, j)), along(S), transform);
+          for (int k = 0; k < gridDim; ++k)
+            for (int l = 0; l < gridDim; ++l)
+              t.check(Dune::FloatCmp::eq(coeff(dEdij, k, l), kg(i * gridDim + k, j * gridDim + l), tol),
+                      "Check geometric stiffness on " + name);
+        }
+      }
+    }
+  };
+  checkTransform(on(gridElement), "grid element");
+  checkTransform(on(referenceElement), "reference element");
+  return t;
+}
+
 int main(int argc, char** argv) {
   Dune::MPIHelper::instance(argc, argv);
   TestSuite t;
@@ -57,6 +104,8 @@ int main(int argc, char** argv) {
   using namespace std;
   auto start = high_resolution_clock::now();
   t.subTest(testGreenLagrangianStrainExpr());
+  t.subTest(testBOperatorAndGeometricStiffness<2>(Dune::GeometryTypes::quadrilateral));
+  t.subTest(testBOperatorAndGeometricStiffness<3>(Dune::GeometryTypes::hexahedron));
 
   auto stop     = high_resolution_clock::now();
   auto duration = duration_cast<milliseconds>(stop - start);
@@ -24,6 +24,10 @@ bool isApproxSame(Derived const& val, OtherDerived const& other, double prec) {
     return val.isApprox(other, prec) or (val - other).isZero(prec);
   else if constexpr (requires { val.isApprox(other, prec); })
     return val.isApprox(other, prec);
+  else if constexpr (requires { val.toDenseMatrix(); })  // Eigen::DiagonalMatrix branch
+    return isApproxSame(val.toDenseMatrix(), other, prec);
+  else if constexpr (requires { other.toDenseMatrix(); })
+    return isApproxSame(val, other.toDenseMatrix(), prec);
   else  // Dune::DiagonalMatrix branch
     return val.diagonal().isApprox(other.diagonal(), prec) or (val.diagonal() - other.diagonal()).isZero(prec);
 }
@@ -0,0 +1,128 @@
+// SPDX-FileCopyrightText: 2022 The dune-localfefunction developers mueller@ibb.uni-stuttgart.de
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <config.h>
+
+#include "testexpression.hh"
+
+#include <dune/localfefunctions/expressions.hh>
+#include <dune/localfefunctions/manifolds/realTuple.hh>
+
+template <int dim>
+using RealT = Dune::RealTuple<double, dim>;
+
+template <typename Expr, typename ExprTest>
+auto testKinematicExpr(Expr& expr, ExprTest& exprTest) {
+  TestSuite t;
+  using namespace Dune;
+  using namespace Dune::Indices;
+  using ManiFoldIDP = ManiFoldTemplateIDPair<RealT, _0>;
+  using FC          = decltype(singleStandardLocalFunction);
+
+  t.subTest(testExpressionsOnCustomGeometry<2, 1, 2, Expr, ExprTest, FC, true, ManiFoldIDP>(
+      Dune::GeometryTypes::quadrilateral, expr, exprTest, singleStandardLocalFunction));
+  t.subTest(testExpressionsOnCustomGeometry<2, 2, 2, Expr, ExprTest, FC, true, ManiFoldIDP>(
+      Dune::GeometryTypes::quadrilateral, expr, exprTest, singleStandardLocalFunction));
+  t.subTest(testExpressionsOnCustomGeometry<3, 1, 3, Expr, ExprTest, FC, true, ManiFoldIDP>(
+      Dune::GeometryTypes::hexahedron, expr, exprTest, singleStandardLocalFunction));
+  t.subTest(testExpressionsOnCustomGeometry<3, 2, 3, Expr, ExprTest, FC, true, ManiFoldIDP>(
+      Dune::GeometryTypes::hexahedron, expr, exprTest, singleStandardLocalFunction));
+  return t;
+}
+
+auto testDeformationGradientAndRightCauchyGreen() {
+  TestSuite t("DeformationGradientAndRightCauchyGreen");
+  using namespace Dune;
+  using namespace Dune::DerivativeDirections;
+
+  auto deformationGradientExpr = [](auto& f) { return deformationGradient(f); };
+  auto deformationGradientTest = [](auto& h, auto&, [[maybe_unused]] auto& fe) {
+    TestSuite tL("DeformationGradientSpecialTests");
+    using HRawType = std::remove_cvref_t<decltype(h)>;
+    static_assert(HRawType::order() == linear);
+    static_assert(HRawType::valueSize == HRawType::gridDim * HRawType::gridDim);
+    return tL;
+  };
+  t.subTest(testKinematicExpr(deformationGradientExpr, deformationGradientTest));
+
+  // C_ij = F_ki F_kj has to coincide with the product of the deformation gradient
+  auto rightCauchyGreenExpr = [](auto& f) { return rightCauchyGreen(f); };
+  auto rightCauchyGreenTest = [](auto& h, auto&, [[maybe_unused]] auto& fe) {
+    TestSuite tL("RightCauchyGreenSpecialTests");
+    using HRawType = std::remove_cvref_t<decltype(h)>;
+    static_assert(HRawType::order() == quadratic);
+    constexpr int dim = HRawType::gridDim;
+    auto F            = deformationGradient(h.m());
+    for (auto [gpIndex, gp] : h.viewOverIntegrationPoints()) {
+      const auto Fvec = toEigen(F.evaluate(gpIndex, on(referenceElement)));
+      const auto C    = toEigen(h.evaluate(gpIndex, on(referenceElement)));
+      const Eigen::Matrix<double, dim, dim> FMat = Eigen::Map<const Eigen::Matrix<double, dim, dim>>(Fvec.data());
+      const Eigen::Matrix<double, dim, dim> CMat = FMat.transpose() * FMat;
+      tL.check(Dune::FloatCmp::eq(CMat(0, 0), C[0]), "Check C11");
+      if constexpr (dim == 2)
+        tL.check(Dune::FloatCmp::eq(CMat(0, 1), C[2]), "Check C12");
+      else if constexpr (dim == 3)
+        tL.check(Dune::FloatCmp::eq(CMat(1, 2), C[3]) and Dune::FloatCmp::eq(CMat(0, 2), C[4])
+                     and Dune::FloatCmp::eq(CMat(0, 1), C[5]),
+                 "Check off diagonal entries of C");
+    }
+    return tL;
+  };
+  t.subTest(testKinematicExpr(rightCauchyGreenExpr, rightCauchyGreenTest));
+  return t;
+}
+
+auto testInvariants() {
+  TestSuite t("Invariants");
+  using namespace Dune;
+  using namespace Dune::DerivativeDirections;
+
+  auto detExpr = [](auto& f) { return det(deformationGradient(f)); };
+  auto detTest = [](auto& h, auto&, [[maybe_unused]] auto& fe) {
+    TestSuite tL("DeterminantSpecialTests");
+    using HRawType    = std::remove_cvref_t<decltype(h)>;
+    constexpr int dim = HRawType::gridDim;
+    auto logJ         = log(h);
+    for (auto [gpIndex, gp] : h.viewOverIntegrationPoints()) {
+      const auto Fvec = toEigen(h.m().evaluate(gpIndex, on(referenceElement)));
+      const double J  = coeff(h.evaluate(gpIndex, on(referenceElement)), 0, 0);
+      tL.check(Dune::FloatCmp::eq(Eigen::Map<const Eigen::Matrix<double, dim, dim>>(Fvec.data()).determinant(), J),
+               "Check determinant");
+      if (J > 0)
+        tL.check(Dune::FloatCmp::eq(std::log(J), coeff(logJ.evaluate(gpIndex, on(referenceElement)), 0, 0)),
+                 "Check log(J)");
+    }
+    return tL;
+  };
+  t.subTest(testKinematicExpr(detExpr, detTest));
+
+  auto traceExpr = [](auto& f) { return trace(rightCauchyGreen(f)); };
+  auto traceTest = [](auto& h, auto&, [[maybe_unused]] auto& fe) {
+    TestSuite tL("TraceSpecialTests");
+    using HRawType = std::remove_cvref_t<decltype(h)>;
+    static_assert(HRawType::order() == quadratic);
+    constexpr int dim = HRawType::gridDim;
+    auto trF          = trace(deformationGradient(h.m().m()));
+    for (auto [gpIndex, gp] : h.viewOverIntegrationPoints()) {
+      const auto C = toEigen(h.m().evaluate(gpIndex, on(referenceElement)));
+      const auto F = toEigen(trF.m().evaluate(gpIndex, on(referenceElement)));
+      tL.check(Dune::FloatCmp::eq(C.template head<dim>().sum(), coeff(h.evaluate(gpIndex, on(referenceElement)), 0, 0)),
+               "Check trace of symmetric matrix in Voigt notation");
+      tL.check(Dune::FloatCmp::eq(Eigen::Map<const Eigen::Matrix<double, dim, dim>>(F.data()).trace(),
+                                  coeff(trF.evaluate(gpIndex, on(referenceElement)), 0, 0)),
+               "Check trace of square matrix");
+    }
+    return tL;
+  };
+  t.subTest(testKinematicExpr(traceExpr, traceTest));
+  return t;
+}
+
+int main(int argc, char** argv) {
+  Dune::MPIHelper::instance(argc, argv);
+  TestSuite t;
+
+  t.subTest(testDeformationGradientAndRightCauchyGreen());
+  t.subTest(testInvariants());
+  return t.exit();
+}
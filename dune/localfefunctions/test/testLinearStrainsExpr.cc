@@ -49,6 +49,74 @@ auto testLinearStrainExpr() {
   return t;
 }
 
+/*
+ * Checks that the cached B-operators coincide with the B-operators computed on each call and that the cache is only
+ * used for the transformation, the leaf node id and the basis binding it was bound for.
+ */
+template <int gridDim>
+auto testBOperatorCache(const Dune::GeometryType& geometryType) {
+  TestSuite t("testBOperatorCache, gridDim: " + std::to_string(gridDim));
+  using namespace Dune;
+  using namespace Dune::DerivativeDirections;
+  auto [f, nodalPoints, geometry, corners, feCache]
+      = Testing::localFunctionTestConstructorNew<RealT<gridDim>, gridDim, gridDim, 1>(geometryType);
+  auto strains       = linearStrains(f);
+  auto strainsCached = linearStrains(f);
+  strainsCached.bindBOperatorCache(on(gridElement));
+
+  const double tol             = 1e-14;
+  const std::size_t coeffsSize = f.coefficientsRef().size();
+  for (auto [gpIndex, gp] : strains.viewOverIntegrationPoints()) {
+    const auto bOperators = strainsCached.cachedBOperators(gpIndex);
+    t.check(bOperators.size() == coeffsSize, "Check number of cached B-operators");
+    for (size_t i = 0; i < coeffsSize; ++i) {
+      const auto bopI = strains.evaluateDerivative(gpIndex, wrt(coeff(i)), on(gridElement));
+      t.check(isApproxSame(bopI, strainsCached.evaluateDerivative(gpIndex, wrt(coeff(i)), on(gridElement)), tol),
+              "Check cached B-operator");
+      t.check(isApproxSame(bopI, bOperators[i], tol), "Check contiguously stored B-operator");
+
+      const auto bopIRef = strains.evaluateDerivative(gpIndex, wrt(coeff(i)), on(referenceElement));
+      t.check(isApproxSame(bopIRef, strainsCached.evaluateDerivative(gpIndex, wrt(coeff(i)), on(referenceElement)),
+                           tol),
+              "Check that the cache is not used for another transformation");
+    }
+  }
+  t.check(strainsCached.usesBOperatorCache(on(gridElement)), "Check that the cache is used");
+  t.check(not strainsCached.usesBOperatorCache(on(referenceElement)),
+          "Check that the cache is bound per transformation");
+  t.check(not strainsCached.usesBOperatorCache<1>(on(gridElement)), "Check that the cache is bound per leaf node id");
+
+  // Binding a copy again must not change the cache of the original
+  auto strainsCopy = strainsCached;
+  strainsCopy.bindBOperatorCache(on(referenceElement));
+  t.check(strainsCopy.usesBOperatorCache(on(referenceElement)), "Check that the copy is bound again");
+  t.check(not strainsCopy.usesBOperatorCache(on(gridElement)), "Check that the copy uses its own cache");
+  t.check(strainsCached.usesBOperatorCache(on(gridElement)), "Check that the original keeps its cache");
+  for (auto [gpIndex, gp] : strains.viewOverIntegrationPoints())
+    for (size_t i = 0; i < coeffsSize; ++i) {
+      t.check(isApproxSame(strains.evaluateDerivative(gpIndex, wrt(coeff(i)), on(gridElement)),
+                           strainsCached.cachedBOperators(gpIndex)[i], tol),
+              "Check cached B-operator of the original after binding the copy");
+      t.check(isApproxSame(strains.evaluateDerivative(gpIndex, wrt(coeff(i)), on(referenceElement)),
+                           strainsCopy.cachedBOperators(gpIndex)[i], tol),
+              "Check cached B-operator of the copy");
+    }
+  strainsCached.unbindBOperatorCache();
+  t.check(not strainsCached.usesBOperatorCache(on(gridElement)), "Check that the cache is released");
+
+  // The cache is keyed on the binding of the basis and not on its address, thus it survives moving the leaf node
+  auto strainsOwned = linearStrains(f.clone());
+  strainsOwned.bindBOperatorCache(on(gridElement));
+  auto strainsMoved = std::move(strainsOwned);
+  t.check(strainsMoved.usesBOperatorCache(on(gridElement)), "Check that a moved leaf node still uses the cache");
+  for (auto [gpIndex, gp] : strainsMoved.viewOverIntegrationPoints())
+    for (size_t i = 0; i < coeffsSize; ++i)
+      t.check(isApproxSame(strains.evaluateDerivative(gpIndex, wrt(coeff(i)), on(gridElement)),
+                           strainsMoved.evaluateDerivative(gpIndex, wrt(coeff(i)), on(gridElement)), tol),
+              "Check cached B-operator after moving");
+  return t;
+}
+
 int main(int argc, char** argv) {
   Dune::MPIHelper::instance(argc, argv);
   TestSuite t;
@@ -57,6 +125,8 @@ int main(int argc, char** argv) {
   using namespace std;
   auto start = high_resolution_clock::now();
   t.subTest(testLinearStrainExpr());
+  t.subTest(testBOperatorCache<2>(Dune::GeometryTypes::quadrilateral));
+  t.subTest(testBOperatorCache<3>(Dune::GeometryTypes::hexahedron));
 
   auto stop     = high_resolution_clock::now();
   auto duration = duration_cast<milliseconds>(stop - start);
@@ -48,6 +48,48 @@ auto testNegateExpr() {
   return t;
 }
 
+auto testSimplifiedNegateExpr() {
+  TestSuite t;
+  using namespace Dune;
+  using namespace Dune::Indices;
+
+  auto expr = [](auto& f) { return -(-(2.0 * f)) + 3.0 * (-f); };
+
+  auto exprTest = [](auto& h, auto&, [[maybe_unused]] auto& fe) {
+    TestSuite tL("SimplifiedNegateExprTests");
+    using HRawType = std::remove_cvref_t<decltype(h)>;
+    using LRawType = std::remove_cvref_t<decltype(h.l())>;
+    using RRawType = std::remove_cvref_t<decltype(h.r())>;
+    static_assert(IsScaleExpr<LRawType>, "-(-(a*f)) should be simplified to a*f");
+    static_assert(IsScaleExpr<RRawType> and !IsNegateExpr<std::remove_cvref_t<decltype(h.r().r())>>,
+                  "a*(-f) should be simplified to (-a)*f");
+    static_assert(HRawType::order() == linear);
+    tL.check(Dune::FloatCmp::eq(h.l().l().value(), 2.0));
+    tL.check(Dune::FloatCmp::eq(h.r().l().value(), -3.0));
+
+    const auto& f = h.node(_0);
+    for (auto [gpIndex, gp] : h.viewOverIntegrationPoints()) {
+      const auto fE = f.evaluate(gpIndex, on(DerivativeDirections::referenceElement));
+      const auto hE = h.evaluate(gpIndex, on(DerivativeDirections::referenceElement));
+      tL.check(isApproxSame(Dune::eval(-fE), hE, 1e-14), "Check simplified function value");
+    }
+    return tL;
+  };
+
+  using ManiFoldIDP = ManiFoldTemplateIDPair<RealT, _0>;
+
+  using Expr     = decltype(expr);
+  using ExprTest = decltype(exprTest);
+  using FC       = decltype(singleStandardLocalFunction);
+
+  t.subTest(
+      testExpressionsOnTriangle<Expr, ExprTest, FC, true, ManiFoldIDP>(expr, exprTest, singleStandardLocalFunction));
+  t.subTest(
+      testExpressionsOnHexahedron<Expr, ExprTest, FC, true, ManiFoldIDP>(expr, exprTest, singleStandardLocalFunction));
+
+  return t;
+}
+
 int main(int argc, char** argv) {
   Dune::MPIHelper::instance(argc, argv);
   TestSuite t;
@@ -56,6 +98,7 @@ int main(int argc, char** argv) {
   using namespace std;
   auto start = high_resolution_clock::now();
   t.subTest(testNegateExpr());
+  t.subTest(testSimplifiedNegateExpr());
 
   auto stop     = high_resolution_clock::now();
   auto duration = duration_cast<milliseconds>(stop - start);
@@ -0,0 +1,125 @@
+// SPDX-FileCopyrightText: 2022 The dune-localfefunction developers mueller@ibb.uni-stuttgart.de
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <config.h>
+
+#include "testexpression.hh"
+
+#include <dune/localfefunctions/expressions.hh>
+#include <dune/localfefunctions/manifolds/realTuple.hh>
+#include <dune/localfefunctions/reverseScalar.hh>
+#include <dune/localfefunctions/vectorDual.hh>
+
+template <int dim>
+using RealT = Dune::RealTuple<double, dim>;
+
+using Reverse            = Dune::ReverseScalar<double>;
+using ForwardOverReverse = Dune::ReverseScalar<Dune::VectorDual<double, 1>>;
+
+auto testScalarRules() {
+  TestSuite t("ScalarRules");
+  using namespace Dune;
+  const Reverse x = Reverse::variable(0.7, 0);
+  const Reverse y = Reverse::variable(1.3, 1);
+
+  // The tape is rewound and recorded again, the gradient has to be the same
+  for (int pass = 0; pass < 2; ++pass) {
+    reverseTape<double>().rewind();
+    const Reverse f = x * y + sin(x) / y + 2.0 * pow(x, 3) - 1;
+    const auto grad = f.gradient();
+    t.check(std::abs(grad[0] - (1.3 + std::cos(0.7) / 1.3 + 6 * 0.7 * 0.7)) < 1e-14, "Check first derivative");
+    t.check(std::abs(grad[1] - (0.7 - std::sin(0.7) / (1.3 * 1.3))) < 1e-14, "Check second derivative");
+  }
+
+  // f = a^2 b + exp(b) with the Hessian [[2b, 2a], [2a, exp(b)]] in the direction (1, 2)
+  VectorDual<double, 1> aValue(0.7), bValue(1.3);
+  aValue.gradient()[0] = 1.0;
+  bValue.gradient()[0] = 2.0;
+
+  const auto a    = ForwardOverReverse::variable(aValue, 0);
+  const auto b    = ForwardOverReverse::variable(bValue, 1);
+  const auto f    = a * a * b + exp(b);
+  const auto grad = f.gradient();
+  t.check(std::abs(grad[0].derivative(0) - (2 * 1.3 + 4 * 0.7)) < 1e-14, "Check first Hessian-vector product entry");
+  t.check(std::abs(grad[1].derivative(0) - (2 * 0.7 + 2 * std::exp(1.3))) < 1e-14,
+          "Check second Hessian-vector product entry");
+  return t;
+}
+
+auto testSeededRebindClone() {
+  TestSuite t;
+  using namespace Dune;
+  using namespace Dune::Indices;
+
+  auto expr = [](auto& f, auto& g) { return 2.0 * normSquared(f) + pow<3>(dot(f, g)); };
+
+  auto exprTest = [](auto& h, auto& vBlockedLocal0, auto&, [[maybe_unused]] auto& fe) {
+    TestSuite tL("ReverseScalarTests");
+    using namespace Dune::DerivativeDirections;
+    constexpr int valueSize = std::remove_cvref_t<decltype(vBlockedLocal0[0])>::valueSize;
+    const int seededLanes   = vBlockedLocal0.size() * valueSize;
+    const auto alongVec     = createOnesVector<double, 1>();
+
+    // f and g share the id and thus the variables, one reverse sweep yields the derivatives w.r.t. all coefficients
+    auto& hReverse = seededRebindClone(h, Reverse());
+    auto& tape     = reverseTape<double>();
+    tL.check(tape.variables() == static_cast<std::size_t>(seededLanes), "Check number of independent variables");
+
+    // The Hessian-vector product is the forward mode derivative of the gradient in the seeded direction
+    const Eigen::VectorXd direction = Eigen::VectorXd::Random(seededLanes);
+    auto& hForwardOverReverse       = seededRebindClone(h, ForwardOverReverse());
+    seedDirectionInEmbedding(hForwardOverReverse, direction);
+
+    std::size_t tapeSize = 0;
+    for (auto [gpIndex, gp] : h.viewOverIntegrationPoints()) {
+      tape.rewind();
+      const auto value = coeff(hReverse.evaluate(gpIndex, on(gridElement)), 0, 0);
+      const auto grad  = value.gradient();
+      tL.check(std::abs(value.value() - coeff(h.evaluate(gpIndex, on(gridElement)), 0, 0)) < 1e-12, "Check value");
+      for (size_t i = 0; i < vBlockedLocal0.size(); ++i) {
+        const auto dhdi = toEigen(h.evaluateDerivative(gpIndex, wrt(coeff(i)), on(gridElement)));
+        for (int j = 0; j < valueSize; ++j)
+          tL.check(std::abs(dhdi(0, j) - grad[i * valueSize + j]) < 1e-12, "Check gradient w.r.t. the coefficients")
+              << dhdi(0, j) << " vs " << grad[i * valueSize + j];
+      }
+      // The same operations are recorded at each integration point, the tape does not grow
+      tL.check(tapeSize == 0 or tape.size() == tapeSize, "Check reuse of the tape");
+      tapeSize = tape.size();
+
+      reverseTape<VectorDual<double, 1>>().rewind();
+      const auto hessianTimesDirection
+          = coeff(hForwardOverReverse.evaluate(gpIndex, on(gridElement)), 0, 0).gradient();
+      for (size_t i = 0; i < vBlockedLocal0.size(); ++i) {
+        Eigen::VectorXd expected = Eigen::VectorXd::Zero(valueSize);
+        for (size_t k = 0; k < vBlockedLocal0.size(); ++k)
+          expected += toEigen(h.evaluateDerivative(gpIndex, wrt(coeff(i, k)), along(alongVec), on(gridElement)))
+                      * direction.segment(k * valueSize, valueSize);
+        for (int j = 0; j < valueSize; ++j)
+          tL.check(std::abs(expected[j] - hessianTimesDirection[i * valueSize + j].derivative(0)) < 1e-10,
+                   "Check Hessian-vector product w.r.t. the coefficients");
+      }
+    }
+    return tL;
+  };
+
+  using ManiFoldIDP = ManiFoldTemplateIDPair<RealT, _0>;
+
+  using Expr     = decltype(expr);
+  using ExprTest = decltype(exprTest);
+  using FC       = decltype(doubleStandardLocalFunctionDouble);
+
+  t.subTest(testExpressionsOnTriangle<Expr, ExprTest, FC, false, ManiFoldIDP, ManiFoldIDP>(
+      expr, exprTest, doubleStandardLocalFunctionDouble));
+  t.subTest(testExpressionsOnHexahedron<Expr, ExprTest, FC, false, ManiFoldIDP, ManiFoldIDP>(
+      expr, exprTest, doubleStandardLocalFunctionDouble));
+  return t;
+}
+
+int main(int argc, char** argv) {
+  Dune::MPIHelper::instance(argc, argv);
+  TestSuite t;
+
+  t.subTest(testScalarRules());
+  t.subTest(testSeededRebindClone());
+  return t.exit();
+}
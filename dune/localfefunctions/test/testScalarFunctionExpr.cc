@@ -0,0 +1,212 @@
+// SPDX-FileCopyrightText: 2022 The dune-localfefunction developers mueller@ibb.uni-stuttgart.de
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <config.h>
+
+#include "testexpression.hh"
+
+#include <dune/localfefunctions/expressions.hh>
+#include <dune/localfefunctions/manifolds/realTuple.hh>
+
+template <int dim>
+using RealT = Dune::RealTuple<double, dim>;
+
+template <typename Expr, typename ExprTest>
+auto testScalarFunctionExpr(Expr& expr, ExprTest& exprTest) {
+  TestSuite t;
+  using namespace Dune;
+  using namespace Dune::Indices;
+  using ManiFoldIDP = ManiFoldTemplateIDPair<RealT, _0>;
+  using FC          = decltype(doubleStandardLocalFunctionDouble);
+
+  t.subTest(testExpressionsOnLine<Expr, ExprTest, FC, true, ManiFoldIDP, ManiFoldIDP>(
+      expr, exprTest, doubleStandardLocalFunctionDouble));
+  t.subTest(testExpressionsOnTriangle<Expr, ExprTest, FC, true, ManiFoldIDP, ManiFoldIDP>(
+      expr, exprTest, doubleStandardLocalFunctionDouble));
+  t.subTest(testExpressionsOnQuadrilateral<Expr, ExprTest, FC, true, ManiFoldIDP, ManiFoldIDP>(
+      expr, exprTest, doubleStandardLocalFunctionDouble));
+  t.subTest(testExpressionsOnHexahedron<Expr, ExprTest, FC, true, ManiFoldIDP, ManiFoldIDP>(
+      expr, exprTest, doubleStandardLocalFunctionDouble));
+  return t;
+}
+
+/* Compares the value of h with the scalar function valueFunction applied to the value of the argument of h */
+template <typename LF, typename ValueFunction>
+auto checkValues(LF& h, ValueFunction&& valueFunction, const std::string& name) {
+  TestSuite tL(name);
+  using namespace Dune;
+  using namespace Dune::DerivativeDirections;
+  using HRawType = std::remove_cvref_t<decltype(h)>;
+  static_assert(HRawType::order() == nonlinear);
+  for (auto [gpIndex, gp] : h.viewOverIntegrationPoints()) {
+    const double x = coeff(h.m().evaluate(gpIndex, on(gridElement)), 0, 0);
+    const double y = coeff(h.evaluate(gpIndex, on(gridElement)), 0, 0);
+    tL.check(std::abs(valueFunction(x) - y) < 1e-12 * std::max(1.0, std::abs(y)), "Check value of " + name);
+  }
+  return tL;
+}
+
+auto testUserDefinedFunction() {
+  TestSuite t("UserDefinedFunction");
+  using namespace Dune;
+  using namespace Dune::DerivativeDirections;
+
+  auto expr = [](auto& f, auto& g) { return scalarFunction([](const auto& x) { return x * x * x; }, dot(f, g)); };
+
+  // The derivatives generated from the value have to coincide with the hand-written ones of pow<3>
+  auto exprTest = [](auto& h, auto& vBlockedLocal0, auto&, [[maybe_unused]] auto& fe) {
+    TestSuite tL(checkValues(h, [](double x) { return x * x * x; }, "cubic"));
+    auto hPow = pow<3>(h.m());
+    for (auto [gpIndex, gp] : h.viewOverIntegrationPoints()) {
+      for (size_t i = 0; i < vBlockedLocal0.size(); ++i) {
+        const auto dhdi    = toEigen(h.evaluateDerivative(gpIndex, wrt(coeff(i)), on(gridElement)));
+        const auto dhPowdi = toEigen(hPow.evaluateDerivative(gpIndex, wrt(coeff(i)), on(gridElement)));
+        tL.check(isApproxSame(dhdi, dhPowdi, 1e-12), "Check first derivative against pow<3>");
+      }
+    }
+    return tL;
+  };
+  t.subTest(testScalarFunctionExpr(expr, exprTest));
+  return t;
+}
+
+/* x^3, which counts how often it is evaluated with a Taylor series */
+struct CountingCubic {
+  inline static int taylorEvaluations = 0;
+
+  template <typename T>
+  T operator()(const T& x) const {
+    if constexpr (not std::is_arithmetic_v<T>) ++taylorEvaluations;
+    return x * x * x;
+  }
+};
+
+/* The derivatives of the function are taken from a single Taylor series per derivative evaluation */
+auto testSingleTaylorEvaluation() {
+  TestSuite t("SingleTaylorEvaluation");
+  using namespace Dune;
+  using namespace Dune::DerivativeDirections;
+
+  CountingCubic::taylorEvaluations = 0;
+  const auto df                    = TaylorFunc<CountingCubic>::derivatives<3>(2.0);
+  t.check(CountingCubic::taylorEvaluations == 1, "The derivatives are computed from one Taylor series");
+  t.check(df[0] == 12.0 and df[1] == 12.0 and df[2] == 6.0, "Check the derivatives of x^3 at x=2");
+
+  auto expr     = [](auto& f, auto& g) { return scalarFunction(CountingCubic{}, dot(f, g)); };
+  auto exprTest = [](auto& h, auto& vBlockedLocal0, auto&, [[maybe_unused]] auto& fe) {
+    TestSuite tL;
+    for (auto [gpIndex, gp] : h.viewOverIntegrationPoints())
+      for (size_t i = 0; i < vBlockedLocal0.size(); ++i) {
+        CountingCubic::taylorEvaluations = 0;
+        h.evaluateDerivative(gpIndex, wrt(coeff(i)), on(gridElement));
+        tL.check(CountingCubic::taylorEvaluations == 1, "One Taylor series for the first derivative");
+
+        CountingCubic::taylorEvaluations = 0;
+        h.evaluateDerivative(gpIndex, wrt(spatialAll, coeff(i)), on(gridElement));
+        tL.check(CountingCubic::taylorEvaluations == 1, "One Taylor series for the second derivative");
+      }
+    return tL;
+  };
+  t.subTest(testScalarFunctionExpr(expr, exprTest));
+  return t;
+}
+
+/* The analytic functors of pow, log and sqrt provide their derivatives separately, the derivatives from the Taylor
+ * series of the same value function have to coincide with them */
+auto testAnalyticFunctions() {
+  TestSuite t("AnalyticFunctions");
+  using namespace Dune;
+  using namespace Dune::DerivativeDirections;
+
+  auto checkFunctor = [&]<typename AnalyticFunc, typename ValueFunction>(AnalyticFunc, ValueFunction, double x,
+                                                                          const std::string& name) {
+    const auto df      = Impl::scalarFunctionDerivatives<3, AnalyticFunc>(x);
+    const auto dfFirst = Impl::scalarFunctionDerivatives<1, AnalyticFunc>(x);
+    const auto dfTay   = TaylorFunc<ValueFunction>::template derivatives<3>(x);
+    for (int k = 0; k < 3; ++k)
+      t.check(std::abs(df[k] - dfTay[k]) < 1e-12 * std::max(1.0, std::abs(df[k])),
+              "Check derivative " + std::to_string(k + 1) + " of " + name);
+    t.check(dfFirst[0] == df[0], "Check first derivative of " + name);
+  };
+  checkFunctor(PowFunc<3>{}, [](const auto& y) { return y * y * y; }, 1.7, "pow<3>");
+  checkFunctor(LogFunc{}, [](const auto& y) { return log(y); }, 1.7, "log");
+  checkFunctor(SqrtFunc{}, [](const auto& y) { return sqrt(y); }, 1.7, "sqrt");
+
+  // The expressions of both functors have to coincide in value and derivatives, the argument is positive
+  auto expr     = [](auto& f, auto&) { return sqrt(normSquared(f)); };
+  auto exprTest = [](auto& h, auto& vBlockedLocal0, auto&, [[maybe_unused]] auto& fe) {
+    TestSuite tL;
+    auto hTaylor        = scalarFunction([](const auto& y) { return sqrt(y); }, h.m());
+    auto hPow           = pow<3>(h.m());
+    auto hPowTaylor     = scalarFunction([](const auto& y) { return y * y * y; }, h.m());
+    auto hLog           = log(h.m());
+    auto hLogTaylor     = scalarFunction([](const auto& y) { return log(y); }, h.m());
+    const auto alongVec = createOnesVector<double, 1>();
+    auto compare        = [&](auto& analytic, auto& taylor, const std::string& name) {
+      for (auto [gpIndex, gp] : h.viewOverIntegrationPoints()) {
+        tL.check(isApproxSame(toEigen(analytic.evaluate(gpIndex, on(gridElement))),
+                              toEigen(taylor.evaluate(gpIndex, on(gridElement))), 1e-12),
+                 "Check value of " + name);
+        for (size_t i = 0; i < vBlockedLocal0.size(); ++i) {
+          tL.check(isApproxSame(toEigen(analytic.evaluateDerivative(gpIndex, wrt(coeff(i)), on(gridElement))),
+                                toEigen(taylor.evaluateDerivative(gpIndex, wrt(coeff(i)), on(gridElement))), 1e-12),
+                   "Check first derivative of " + name);
+          for (size_t j = 0; j < vBlockedLocal0.size(); ++j)
+            tL.check(isApproxSame(toEigen(analytic.evaluateDerivative(gpIndex, wrt(coeff(i, j)), along(alongVec),
+                                                                      on(gridElement))),
+                                  toEigen(taylor.evaluateDerivative(gpIndex, wrt(coeff(i, j)), along(alongVec),
+                                                                    on(gridElement))),
+                                  1e-12),
+                     "Check second derivative of " + name);
+        }
+      }
+    };
+    compare(h, hTaylor, "sqrt");
+    compare(hPow, hPowTaylor, "pow<3>");
+    compare(hLog, hLogTaylor, "log");
+    return tL;
+  };
+  t.subTest(testScalarFunctionExpr(expr, exprTest));
+  return t;
+}
+
+auto testLibraryFunctions() {
+  TestSuite t("LibraryFunctions");
+  using namespace Dune;
+
+  auto expExpr = [](auto& f, auto& g) { return exp(dot(f, g)); };
+  auto expTest = [](auto& h, auto&, auto&, [[maybe_unused]] auto& fe) {
+    return checkValues(h, [](double x) { return std::exp(x); }, "exp");
+  };
+  t.subTest(testScalarFunctionExpr(expExpr, expTest));
+
+  auto tanhExpr = [](auto& f, auto& g) { return tanh(dot(f, g)); };
+  auto tanhTest = [](auto& h, auto&, auto&, [[maybe_unused]] auto& fe) {
+    return checkValues(h, [](double x) { return std::tanh(x); }, "tanh");
+  };
+  t.subTest(testScalarFunctionExpr(tanhExpr, tanhTest));
+
+  auto softplusExpr = [](auto& f, auto& g) { return softplus(-1.0 * dot(f, g)); };
+  auto softplusTest = [](auto& h, auto&, auto&, [[maybe_unused]] auto& fe) {
+    return checkValues(h, [](double x) { return std::log1p(std::exp(x)); }, "softplus");
+  };
+  t.subTest(testScalarFunctionExpr(softplusExpr, softplusTest));
+
+  auto smoothAbsExpr = [](auto& f, auto& g) { return smoothAbs(-1.0 * dot(f, g)); };
+  auto smoothAbsTest = [](auto& h, auto&, auto&, [[maybe_unused]] auto& fe) {
+    return checkValues(h, [](double x) { return std::sqrt(x * x + 1e-16); }, "smoothAbs");
+  };
+  t.subTest(testScalarFunctionExpr(smoothAbsExpr, smoothAbsTest));
+  return t;
+}
+
+int main(int argc, char** argv) {
+  Dune::MPIHelper::instance(argc, argv);
+  TestSuite t;
+
+  t.subTest(testUserDefinedFunction());
+  t.subTest(testSingleTaylorEvaluation());
+  t.subTest(testAnalyticFunctions());
+  t.subTest(testLibraryFunctions());
+  return t.exit();
+}
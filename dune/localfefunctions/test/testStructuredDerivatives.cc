@@ -0,0 +1,83 @@
+// SPDX-FileCopyrightText: 2022 The dune-localfefunction developers mueller@ibb.uni-stuttgart.de
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <config.h>
+
+#include "testexpression.hh"
+
+#include <dune/localfefunctions/expressions.hh>
+#include <dune/localfefunctions/manifolds/realTuple.hh>
+
+using namespace Dune::GeometryTypes;
+
+template <int dim>
+using RealT = Dune::RealTuple<double, dim>;
+
+/*
+ * Checks that the derivatives w.r.t. the coefficients keep their scaled identity structure through sums, scalings and
+ * negations of vector valued functions and that the structured derivatives have the correct values.
+ */
+template <int gridDim, int valueSize>
+auto testStructuredDerivatives(const Dune::GeometryType& geometryType) {
+  TestSuite t("testStructuredDerivatives, gridDim: " + std::to_string(gridDim));
+  using namespace Dune;
+  using namespace Dune::DerivativeDirections;
+  auto [f, nodalPoints, geometry, corners, feCache]
+      = Testing::localFunctionTestConstructorNew<RealT<valueSize>, gridDim, gridDim, 1>(geometryType);
+
+  using CoeffDerivMatrix = typename DefaultLinearAlgebra::template FixedSizedScaledIdentityMatrix<double, valueSize>;
+  static_assert(sizeof(CoeffDerivMatrix) <= valueSize * sizeof(double),
+                "The derivatives w.r.t. the coefficients should not be stored as dense matrices");
+
+  auto sum      = f + f;
+  auto scaled   = 2.0 * f;
+  auto negated  = -f;
+  auto combined = -(f + 3.0 * f);
+  auto strains  = greenLagrangeStrains(f);
+
+  const double tol     = 1e-14;
+  const auto& basis    = f.basis();
+  const auto stressVec = createOnesVector<double, decltype(strains)::strainSize>();
+
+  for (auto [gpIndex, gp] : f.viewOverIntegrationPoints()) {
+    const auto& N  = basis.evaluateFunction(gpIndex);
+    const auto& dN = basis.evaluateJacobian(gpIndex);
+    for (size_t i = 0; i < N.size(); ++i) {
+      auto checkStructure = [&](const auto& h, double factor, const std::string& name) {
+        const auto dhdi = h.evaluateDerivative(gpIndex, wrt(coeff(i)), on(referenceElement));
+        static_assert(std::is_same_v<std::remove_cvref_t<decltype(dhdi)>, CoeffDerivMatrix>);
+        t.check(isApproxSame(dhdi, createScaledIdentityMatrix<double, valueSize, valueSize>(factor * N[i]), tol),
+                "Check coefficient derivative of " + name);
+
+        const auto dhdidS = h.evaluateDerivative(gpIndex, wrt(coeff(i), spatialAll), on(referenceElement));
+        static_assert(std::is_same_v<std::remove_cvref_t<decltype(dhdidS[0])>, CoeffDerivMatrix>);
+        for (int d = 0; d < gridDim; ++d)
+          t.check(isApproxSame(dhdidS[d],
+                               createScaledIdentityMatrix<double, valueSize, valueSize>(factor * coeff(dN, i, d)), tol),
+                  "Check mixed coefficient and spatial derivative of " + name);
+      };
+
+      checkStructure(f, 1.0, "f");
+      checkStructure(sum, 2.0, "f+f");
+      checkStructure(scaled, 2.0, "2*f");
+      checkStructure(negated, -1.0, "-f");
+      checkStructure(combined, -4.0, "-(f+3*f)");
+
+      for (size_t j = 0; j < N.size(); ++j) {
+        const auto dEdij
+            = strains.evaluateDerivative(gpIndex, wrt(coeff(i, j)), along(stressVec), on(referenceElement));
+        static_assert(std::is_same_v<std::remove_cvref_t<decltype(dEdij)>, CoeffDerivMatrix>);
+      }
+    }
+  }
+  return t;
+}
+
+int main(int argc, char** argv) {
+  Dune::MPIHelper::instance(argc, argv);
+  TestSuite t;
+
+  t.subTest(testStructuredDerivatives<2, 2>(quadrilateral));
+  t.subTest(testStructuredDerivatives<3, 3>(hexahedron));
+  return t.exit();
+}
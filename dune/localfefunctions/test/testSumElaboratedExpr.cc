@@ -3,8 +3,14 @@
 
 #include <config.h>
 
+// The profiler counts the evaluations, which are not served by the memo
+#ifndef DUNE_LOCALFEFUNCTIONS_ENABLE_PROFILING
+#  define DUNE_LOCALFEFUNCTIONS_ENABLE_PROFILING 1
+#endif
+
 #include "testexpression.hh"
 
+#include <dune/localfefunctions/evaluationProfiler.hh>
 #include <dune/localfefunctions/expressions.hh>
 #include <dune/localfefunctions/manifolds/realTuple.hh>
 
@@ -42,7 +48,7 @@ auto testElaboratedSum() {
     tL.check(HRawType::id[0] == 0 and HRawType::id[1] == 1 and HRawType::id[2] == 1);
 
     static_assert(HRawType::order(_0) == linear);
-    static_assert(HRawType::order(_1) == linear);
+    static_assert(HRawType::order(_1) == quadratic);
     static_assert(HRawType::order(_2) == constant);
     static_assert(FRawType::order(_0) == linear);
     static_assert(FRawType::order(_1) == constant);
@@ -147,6 +153,76 @@ auto testElaboratedSum() {
   return t;
 }
 
+/*
+ * The values and derivatives of subexpressions are memoized during one evaluation. This checks that the memoized
+ * results are not reused across evaluations, i.e. after changing the coefficients or the integration point.
+ */
+auto testMemoizedEvaluation() {
+  TestSuite t("testMemoizedEvaluation");
+  using namespace Dune;
+  using namespace Dune::DerivativeDirections;
+  auto [f, nodalPoints, geometry, corners, feCache]
+      = Testing::localFunctionTestConstructorNew<RealT<2>, 2, 2, 1>(quadrilateral);
+  auto h = dot(f + f, f);
+
+  for (int update = 0; update < 2; ++update) {
+    for (auto [gpIndex, gp] : f.viewOverIntegrationPoints()) {
+      const auto fE = f.evaluate(gpIndex, on(referenceElement));
+      const auto hE = h.evaluate(gpIndex, on(referenceElement));
+      t.check(Dune::FloatCmp::eq(2 * inner(fE, fE), coeff(hE, 0, 0)), "Check memoized function value");
+
+      const auto dfE = f.evaluateDerivative(gpIndex, wrt(spatialAll), on(referenceElement));
+      const auto dhE = h.evaluateDerivative(gpIndex, wrt(spatialAll), on(referenceElement));
+      const auto dhExpected = eval(4 * transposeEvaluated(leftMultiplyTranspose(dfE, fE)));
+      t.check(isApproxSame(dhExpected, dhE, 1e-13), "Check memoized spatial derivative");
+    }
+    f.coefficientsRef()[0].update(createOnesVector<double, 2>());
+  }
+
+  // Sums of the same type with different leaf nodes must not evict each others results
+  auto g       = f.clone();
+  auto k       = f.clone();
+  auto hShared = dot(f + g, g + k) + dot(k + f, f + g);
+  /* Sums the statistics of the leaf nodes for the signature over all transformations and integration point types */
+  auto leafEntry = [&](const std::string& signature) {
+    const std::string leafName(expressionDescription<decltype(f)>());
+    EvaluationProfileEntry sum{leafName, signature};
+    for (const auto& entry : evaluationProfile().entries())
+      if (entry.node == leafName and entry.signature == signature) {
+        sum.calls += entry.calls;
+        sum.evaluations += entry.evaluations;
+      }
+    return sum;
+  };
+
+  std::size_t ipCount = 0;
+  evaluationProfile().reset();
+  for (auto [gpIndex, gp] : f.viewOverIntegrationPoints()) {
+    hShared.evaluate(gpIndex, on(gridElement));
+    ++ipCount;
+  }
+  const auto leafValue = leafEntry("value");
+  t.check(leafValue.evaluations == 3 * ipCount and leafValue.calls > leafValue.evaluations,
+          "Each leaf node value is evaluated once per integration point")
+      << leafValue.calls << " calls and " << leafValue.evaluations << " evaluations";
+
+  const std::size_t coeffsSize = 2;
+  std::size_t derivativeCalls  = 0;
+  evaluationProfile().reset();
+  for (auto [gpIndex, gp] : f.viewOverIntegrationPoints())
+    for (std::size_t i = 0; i < coeffsSize; ++i)
+      for (std::size_t j = 0; j < coeffsSize; ++j) {
+        hShared.evaluateDerivative(gpIndex, wrt(coeff(i, j)), on(gridElement));
+        ++derivativeCalls;
+      }
+  // Each of the three leaf nodes has to compute its first derivative w.r.t. i and j only once per call
+  const auto leafDerivative = leafEntry("d/(dcoeff)");
+  t.check(leafDerivative.evaluations <= 6 * derivativeCalls and leafDerivative.calls > leafDerivative.evaluations,
+          "Memoized first derivatives of the leaf nodes are reused")
+      << leafDerivative.calls << " calls and " << leafDerivative.evaluations << " evaluations";
+  return t;
+}
+
 int main(int argc, char** argv) {
   Dune::MPIHelper::instance(argc, argv);
   TestSuite t;
@@ -155,6 +231,7 @@ int main(int argc, char** argv) {
   using namespace std;
   auto start = high_resolution_clock::now();
   t.subTest(testElaboratedSum());
+  t.subTest(testMemoizedEvaluation());
   auto stop     = high_resolution_clock::now();
   auto duration = duration_cast<milliseconds>(stop - start);
   cout << "The test execution took: " << duration.count() << endl;
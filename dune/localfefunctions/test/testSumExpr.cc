@@ -63,6 +63,53 @@ auto testSum() {
   return t;
 }
 
+/* The derivatives of the operands have different types, e.g. f has a diagonal derivative w.r.t. its coefficients and
+ * the cross product a dense one */
+auto testSumOfDifferentTypes() {
+  TestSuite t;
+  using namespace Dune;
+  using namespace Dune::Indices;
+
+  auto expr = [](auto& f, auto& g) { return f + cross(f, g); };
+
+  auto exprTest = [](auto& h, auto&, auto&, [[maybe_unused]] auto& fe) {
+    TestSuite tL("SumOfDifferentTypesTests");
+    using namespace Dune::DerivativeDirections;
+    static_assert(not std::is_same_v<std::remove_cvref_t<decltype(h.l())>, std::remove_cvref_t<decltype(h.r())>>);
+    const std::size_t coeffsSize = h.node(_0).coefficientsRef().size();
+
+    for (auto [gpIndex, gp] : h.viewOverIntegrationPoints()) {
+      const auto u = toEigen(h.l().evaluate(gpIndex, on(gridElement)));
+      const auto w = toEigen(h.r().evaluate(gpIndex, on(gridElement)));
+      tL.check(isApproxSame((u + w).eval(), toEigen(h.evaluate(gpIndex, on(gridElement))), 1e-14),
+               "Check value of sum of different types");
+
+      for (std::size_t i = 0; i < coeffsSize; ++i) {
+        const auto du = h.l().evaluateDerivative(gpIndex, wrt(coeff(i)), on(gridElement));
+        const auto dw = h.r().evaluateDerivative(gpIndex, wrt(coeff(i)), on(gridElement));
+        const auto dh = h.evaluateDerivative(gpIndex, wrt(coeff(i)), on(gridElement));
+        tL.check(isApproxSame(Dune::eval(du + dw), Dune::eval(dh), 1e-14),
+                 "Check derivative of sum of different types");
+      }
+    }
+    return tL;
+  };
+
+  using ManiFoldIDP = ManiFoldTemplateIDPair<RealT, _0>;
+
+  using Expr     = decltype(expr);
+  using ExprTest = decltype(exprTest);
+
+  using FunctionConstructor = decltype(doubleStandardLocalFunctionDistinct);
+  t.subTest(testExpressionsOnCustomGeometry<2, 1, 3, Expr, ExprTest, FunctionConstructor, true, ManiFoldIDP,
+                                            ManiFoldIDP>(Dune::GeometryTypes::quadrilateral, expr, exprTest,
+                                                         doubleStandardLocalFunctionDistinct));
+  t.subTest(testExpressionsOnCustomGeometry<3, 1, 3, Expr, ExprTest, FunctionConstructor, true, ManiFoldIDP,
+                                            ManiFoldIDP>(Dune::GeometryTypes::hexahedron, expr, exprTest,
+                                                         doubleStandardLocalFunctionDistinct));
+  return t;
+}
+
 int main(int argc, char** argv) {
   Dune::MPIHelper::instance(argc, argv);
   TestSuite t;
@@ -71,6 +118,7 @@ int main(int argc, char** argv) {
   using namespace std;
   auto start = high_resolution_clock::now();
   t.subTest(testSum());
+  t.subTest(testSumOfDifferentTypes());
   auto stop     = high_resolution_clock::now();
   auto duration = duration_cast<milliseconds>(stop - start);
   cout << "The test execution took: " << duration.count() << endl;
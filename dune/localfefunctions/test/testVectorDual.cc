@@ -0,0 +1,86 @@
+// SPDX-FileCopyrightText: 2022 The dune-localfefunction developers mueller@ibb.uni-stuttgart.de
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <config.h>
+
+#include "testexpression.hh"
+
+#include <dune/localfefunctions/expressions.hh>
+#include <dune/localfefunctions/manifolds/realTuple.hh>
+#include <dune/localfefunctions/vectorDual.hh>
+
+template <int dim>
+using RealT = Dune::RealTuple<double, dim>;
+
+/* Enough lanes for all coefficients of the quadratic quadrilateral with a 3d local function */
+using Dual = Dune::VectorDual<double, 27>;
+
+auto testScalarRules() {
+  TestSuite t("ScalarRules");
+  const Dual x = Dual::variable(0.7, 0);
+  const Dual y = Dual::variable(1.3, 1);
+
+  const Dual f      = sqrt(x * y) / (2.0 - pow(x, 3)) + exp(y);
+  const double s    = std::sqrt(0.7 * 1.3), q = 2.0 - std::pow(0.7, 3);
+  const double dfdx = 0.5 * 1.3 / s / q + s * 3 * 0.7 * 0.7 / (q * q);
+  const double dfdy = 0.5 * 0.7 / s / q + std::exp(1.3);
+  t.check(std::abs(f.value() - (s / q + std::exp(1.3))) < 1e-14, "Check value");
+  t.check(std::abs(f.derivative(0) - dfdx) < 1e-14, "Check derivative w.r.t. first lane") << f.derivative(0);
+  t.check(std::abs(f.derivative(1) - dfdy) < 1e-14, "Check derivative w.r.t. second lane") << f.derivative(1);
+  t.check(std::ranges::all_of(f.gradient().begin() + 2, f.gradient().end(), [](double d) { return d == 0.0; }),
+          "Check that the unseeded lanes vanish");
+  return t;
+}
+
+auto testSeededRebindClone() {
+  TestSuite t;
+  using namespace Dune;
+  using namespace Dune::Indices;
+
+  auto expr = [](auto& f, auto& g) { return 2.0 * normSquared(f) + pow<3>(dot(f, g)); };
+
+  auto exprTest = [](auto& h, auto& vBlockedLocal0, auto&, [[maybe_unused]] auto& fe) {
+    TestSuite tL("SeededRebindCloneTests");
+    using namespace Dune::DerivativeDirections;
+    constexpr int valueSize = std::remove_cvref_t<decltype(vBlockedLocal0[0])>::valueSize;
+    const int seededLanes   = vBlockedLocal0.size() * valueSize;
+
+    for (auto [gpIndex, gp] : h.viewOverIntegrationPoints()) {
+      // f and g share the id and thus the lanes, one evaluation yields the derivatives w.r.t. all coefficients
+      auto& hDual      = seededRebindClone(h, Dual());
+      const auto value = coeff(hDual.evaluate(gpIndex, on(gridElement)), 0, 0);
+      tL.check(std::abs(value.value() - coeff(h.evaluate(gpIndex, on(gridElement)), 0, 0)) < 1e-12, "Check value");
+      for (size_t i = 0; i < vBlockedLocal0.size(); ++i) {
+        const auto dhdi = toEigen(h.evaluateDerivative(gpIndex, wrt(coeff(i)), on(gridElement)));
+        for (int j = 0; j < valueSize; ++j)
+          tL.check(std::abs(dhdi(0, j) - value.derivative(i * valueSize + j)) < 1e-12,
+                   "Check gradient w.r.t. the coefficients")
+              << dhdi(0, j) << " vs " << value.derivative(i * valueSize + j);
+      }
+      for (int lane = seededLanes; lane < Dual::lanes; ++lane)
+        tL.check(value.derivative(lane) == 0.0, "Check that the unseeded lanes vanish");
+    }
+    return tL;
+  };
+
+  using ManiFoldIDP = ManiFoldTemplateIDPair<RealT, _0>;
+
+  using Expr     = decltype(expr);
+  using ExprTest = decltype(exprTest);
+  using FC       = decltype(doubleStandardLocalFunctionDouble);
+
+  t.subTest(testExpressionsOnTriangle<Expr, ExprTest, FC, false, ManiFoldIDP, ManiFoldIDP>(
+      expr, exprTest, doubleStandardLocalFunctionDouble));
+  t.subTest(testExpressionsOnQuadrilateral<Expr, ExprTest, FC, false, ManiFoldIDP, ManiFoldIDP>(
+      expr, exprTest, doubleStandardLocalFunctionDouble));
+  return t;
+}
+
+int main(int argc, char** argv) {
+  Dune::MPIHelper::instance(argc, argv);
+  TestSuite t;
+
+  t.subTest(testScalarRules());
+  t.subTest(testSeededRebindClone());
+  return t.exit();
+}
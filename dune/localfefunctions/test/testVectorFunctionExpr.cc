@@ -0,0 +1,150 @@
+// SPDX-FileCopyrightText: 2022 The dune-localfefunction developers mueller@ibb.uni-stuttgart.de
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <config.h>
+
+#include "testexpression.hh"
+
+#include <dune/localfefunctions/expressions.hh>
+#include <dune/localfefunctions/manifolds/realTuple.hh>
+
+template <int dim>
+using RealT = Dune::RealTuple<double, dim>;
+
+template <typename Expr, typename ExprTest>
+auto testVectorFunctionExpr(Expr& expr, ExprTest& exprTest) {
+  TestSuite t;
+  using namespace Dune;
+  using namespace Dune::Indices;
+  using ManiFoldIDP = ManiFoldTemplateIDPair<RealT, _0>;
+  using FC          = decltype(singleStandardLocalFunction);
+
+  t.subTest(testExpressionsOnLine<Expr, ExprTest, FC, true, ManiFoldIDP>(expr, exprTest, singleStandardLocalFunction));
+  t.subTest(
+      testExpressionsOnTriangle<Expr, ExprTest, FC, true, ManiFoldIDP>(expr, exprTest, singleStandardLocalFunction));
+  t.subTest(testExpressionsOnQuadrilateral<Expr, ExprTest, FC, true, ManiFoldIDP>(expr, exprTest,
+                                                                                  singleStandardLocalFunction));
+  t.subTest(
+      testExpressionsOnHexahedron<Expr, ExprTest, FC, true, ManiFoldIDP>(expr, exprTest, singleStandardLocalFunction));
+  return t;
+}
+
+auto testScalarResult() {
+  TestSuite t("ScalarResult");
+  using namespace Dune;
+
+  auto expr = [](auto& f) {
+    return vectorFunction(
+        [](const auto& v) {
+          std::remove_cvref_t<decltype(v[0])> s = v[0] * v[0];
+          for (int i = 1; i < static_cast<int>(v.size()); ++i)
+            s += v[i] * v[i];
+          return s;
+        },
+        f);
+  };
+
+  // The chained derivatives have to coincide with the hand-written ones of normSquared
+  auto exprTest = [](auto& h, auto& vBlockedLocal, [[maybe_unused]] auto& fe) {
+    TestSuite tL("NormSquaredComparison");
+    using namespace Dune::DerivativeDirections;
+    using HRawType = std::remove_cvref_t<decltype(h)>;
+    static_assert(HRawType::order() == nonlinear);
+    static_assert(HRawType::valueSize == 1);
+
+    auto hNormSquared = normSquared(h.m());
+    for (auto [gpIndex, gp] : h.viewOverIntegrationPoints()) {
+      const double value            = coeff(h.evaluate(gpIndex, on(gridElement)), 0, 0);
+      const double valueNormSquared = coeff(hNormSquared.evaluate(gpIndex, on(gridElement)), 0, 0);
+      tL.check(std::abs(value - valueNormSquared) < 1e-12, "Check value against normSquared");
+      for (size_t i = 0; i < vBlockedLocal.size(); ++i) {
+        const auto dhdi            = toEigen(h.evaluateDerivative(gpIndex, wrt(coeff(i)), on(gridElement)));
+        const auto dhNormSquareddi = toEigen(hNormSquared.evaluateDerivative(gpIndex, wrt(coeff(i)), on(gridElement)));
+        tL.check(isApproxSame(dhdi, dhNormSquareddi, 1e-12), "Check first derivative against normSquared");
+        for (size_t k = 0; k < vBlockedLocal.size(); ++k) {
+          const auto d2hdik = toEigen(h.evaluateDerivative(gpIndex, wrt(coeff(i, k)), on(gridElement)));
+          const auto d2hNormSquareddik
+              = toEigen(hNormSquared.evaluateDerivative(gpIndex, wrt(coeff(i, k)), on(gridElement)));
+          tL.check(isApproxSame(d2hdik, d2hNormSquareddik, 1e-12), "Check second derivative against normSquared");
+        }
+      }
+    }
+    return tL;
+  };
+  t.subTest(testVectorFunctionExpr(expr, exprTest));
+  return t;
+}
+
+auto testVectorResult() {
+  TestSuite t("VectorResult");
+  using namespace Dune;
+
+  // A nonlinear map with coupled components, where all the derivatives of the value function contribute
+  auto expr = [](auto& f) {
+    return vectorFunction(
+        [](const auto& v) {
+          auto res = v;
+          for (int i = 0; i < static_cast<int>(v.size()); ++i)
+            res[i] = sin(v[i]) * v[0] + 0.5 * v[i] * v[i] * v[i];
+          return res;
+        },
+        f);
+  };
+
+  // Compare with the hand-computed derivatives of F_k(u) = sin(u_k) u_0 + u_k^3 / 2 chained with the ones of u
+  auto exprTest = [](auto& h, auto& vBlockedLocal, [[maybe_unused]] auto& fe) {
+    TestSuite tL("VectorResultTests");
+    using namespace Dune::DerivativeDirections;
+    using HRawType  = std::remove_cvref_t<decltype(h)>;
+    constexpr int n = HRawType::valueSize;
+    static_assert(n == std::remove_cvref_t<decltype(h.m())>::valueSize);
+    static_assert(HRawType::order() == nonlinear);
+
+    const auto alongVec = createOnesVector<double, n>();
+    for (auto [gpIndex, gp] : h.viewOverIntegrationPoints()) {
+      const Eigen::Vector<double, n> u = toEigen(h.m().evaluate(gpIndex, on(gridElement)));
+
+      // F, its Jacobian J and the Hessian H of lambda^T F for lambda = (1, ..., 1)
+      Eigen::Vector<double, n> F;
+      Eigen::Matrix<double, n, n> J, H;
+      J.setZero();
+      H.setZero();
+      for (int k = 0; k < n; ++k) {
+        F[k] = std::sin(u[k]) * u[0] + 0.5 * u[k] * u[k] * u[k];
+        J(k, k) += std::cos(u[k]) * u[0] + 1.5 * u[k] * u[k];
+        J(k, 0) += std::sin(u[k]);
+        H(k, k) += -std::sin(u[k]) * u[0] + 3.0 * u[k];
+        H(k, 0) += std::cos(u[k]);
+        H(0, k) += std::cos(u[k]);
+      }
+
+      const Eigen::Vector<double, n> value = toEigen(h.evaluate(gpIndex, on(gridElement)));
+      tL.check(isApproxSame(value, F, 1e-12), "Check value against the reference");
+
+      // u is linear in the coefficients with u_i = N_i I, thus the second derivatives of u vanish
+      const auto& N = h.m().basis().evaluateFunction(gpIndex);
+      for (size_t i = 0; i < vBlockedLocal.size(); ++i) {
+        const auto dhdi = toEigen(h.evaluateDerivative(gpIndex, wrt(coeff(i)), on(gridElement)));
+        tL.check(isApproxSame(dhdi, (N[i] * J).eval(), 1e-12), "Check first derivative against the reference");
+        for (size_t k = 0; k < vBlockedLocal.size(); ++k) {
+          const auto d2hdik
+              = toEigen(h.evaluateDerivative(gpIndex, wrt(coeff(i, k)), along(alongVec), on(gridElement)));
+          tL.check(isApproxSame(d2hdik, (N[i] * N[k] * H).eval(), 1e-12),
+                   "Check second derivative against the reference");
+        }
+      }
+    }
+    return tL;
+  };
+  t.subTest(testVectorFunctionExpr(expr, exprTest));
+  return t;
+}
+
+int main(int argc, char** argv) {
+  Dune::MPIHelper::instance(argc, argv);
+  TestSuite t;
+
+  t.subTest(testScalarResult());
+  t.subTest(testVectorResult());
+  return t.exit();
+}
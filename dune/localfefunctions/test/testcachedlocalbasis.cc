@@ -13,6 +13,10 @@ using Dune::TestSuite;
 #include "testFacilities.hh"
 
 #include <complex>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <limits>
 
 #include <dune/common/classname.hh>
 #include <dune/common/fmatrix.hh>
@@ -21,6 +25,7 @@ using Dune::TestSuite;
 #include <dune/functions/functionspacebases/lagrangebasis.hh>
 #include <dune/grid/yaspgrid.hh>
 #include <dune/localfefunctions/cachedlocalBasis/cachedlocalBasis.hh>
+#include <dune/localfefunctions/cachedlocalBasis/tabulation.hh>
 #include <dune/localfefunctions/eigenDuneTransformations.hh>
 #include <dune/localfefunctions/linearAlgebraHelper.hh>
 
@@ -122,6 +127,86 @@ auto testLocalBasis(LB& localBasis, const Dune::GeometryType& type) {
     t.check(localBasis.isBound(1));
   }
 
+  for (const auto& [index, ip, N, dN] : localBasis.viewOverFunctionAndJacobian()) {
+    t.check(ip.position() == rule[index].position(), "Check integration point of the view");
+    t.check(&N == &localBasis.evaluateFunction(index), "Check ansatz functions of the view");
+    t.check(&dN == &localBasis.evaluateJacobian(index), "Check ansatz function derivatives of the view");
+  }
+
+  // Tabulation round trip
+  const auto fileName = (std::filesystem::temp_directory_path()
+                         / ("testcachedlocalbasis" + std::to_string(gridDim) + "." + std::to_string(localBasis.order())
+                            + "." + std::to_string(type.id()) + ".tab"))
+                            .string();
+  saveTabulation(localBasis, fileName);
+  {
+    const MappedTabulation<gridDim> tabulation(fileName);
+    t.check(tabulation.size() == localBasis.size() and tabulation.integrationPointSize() == rule.size());
+    t.check(tabulation.isBound(2) == (gridDim > 1), "Check tabulated second derivatives");
+
+    auto mappedBasis = localBasis;
+    mappedBasis.bind(tabulation);
+    t.check(mappedBasis.integrationRule().type() == type and mappedBasis.integrationRule().order() == rule.order());
+    t.check(mappedBasis.boundDerivativeOrders() == localBasis.boundDerivativeOrders());
+    for (const auto& [index, ip, N, dN] : mappedBasis.viewOverFunctionAndJacobian()) {
+      t.check(ip.position() == rule[index].position() and ip.weight() == rule[index].weight(),
+              "Check integration point of the tabulation");
+      t.check(tabulation.evaluateFunction(index) == toEigen(localBasis.evaluateFunction(index)),
+              "Check mapped ansatz functions");
+      t.check(tabulation.evaluateJacobian(index) == toEigen(localBasis.evaluateJacobian(index)),
+              "Check mapped ansatz function derivatives");
+      t.check(toEigen(N) == toEigen(localBasis.evaluateFunction(index)), "Check ansatz functions bound to tabulation");
+      t.check(toEigen(dN) == toEigen(localBasis.evaluateJacobian(index)),
+              "Check ansatz function derivatives bound to tabulation");
+      if constexpr (gridDim > 1)
+        t.check(toEigen(mappedBasis.evaluateSecondDerivatives(index))
+                    == toEigen(localBasis.evaluateSecondDerivatives(index)),
+                "Check ansatz function second derivatives bound to tabulation");
+    }
+  }
+  try {
+    const MappedTabulation<gridDim == 3 ? 1 : gridDim + 1> tabulation(fileName);
+    t.check(false, "Mapping a tabulation of another dimension should have thrown! You should not end up here.");
+  } catch (const Dune::IOError&) {
+  }
+
+  // Corrupted headers are rejected before any section is accessed
+  const auto corruptedFileName = fileName + ".corrupted";
+  auto corruptHeader           = [&](auto&& corrupt) {
+    std::ifstream in(fileName, std::ios::binary);
+    std::vector<char> data((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+    Dune::TabulationHeader header;
+    std::memcpy(&header, data.data(), sizeof(header));
+    corrupt(header);
+    std::memcpy(data.data(), &header, sizeof(header));
+    std::ofstream(corruptedFileName, std::ios::binary).write(data.data(), static_cast<std::streamsize>(data.size()));
+  };
+  corruptHeader([](auto& header) { header.integrationPoints = std::numeric_limits<std::uint64_t>::max() / 2; });
+  try {
+    const MappedTabulation<gridDim> tabulation(corruptedFileName);
+    t.check(false, "Mapping a tabulation with overflowing sizes should have thrown! You should not end up here.");
+  } catch (const Dune::IOError&) {
+  }
+  corruptHeader([](auto& header) { header.topologyId = 1U << gridDim; });
+  try {
+    const MappedTabulation<gridDim> tabulation(corruptedFileName);
+    t.check(false, "Mapping a tabulation with an invalid topology should have thrown! You should not end up here.");
+  } catch (const Dune::IOError&) {
+  }
+  if constexpr (gridDim > 1) {
+    corruptHeader([&](auto& header) { header.topologyId = type.isSimplex() ? (1U << gridDim) - 1 : 0; });
+    try {
+      const MappedTabulation<gridDim> tabulation(corruptedFileName);
+      auto mappedBasis = localBasis;
+      mappedBasis.bind(tabulation);
+      t.check(false, "Binding a tabulation of another topology should have thrown! You should not end up here.");
+    } catch (const Dune::IOError&) {
+    } catch (const std::logic_error&) {
+    }
+  }
+  std::filesystem::remove(corruptedFileName);
+  std::filesystem::remove(fileName);
+
   return t;
 }
 
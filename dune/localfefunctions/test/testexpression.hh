@@ -174,8 +174,8 @@ TestSuite testLocalFunction(const LF& lf, bool isCopy = false) {
                                                       : createRandomVector<double, localFunctionValueSize>();
     const auto alongMat = localFunctionValueSize == 1 ? createOnesMatrix<double, localFunctionValueSize, gridDim>()
                                                       : createRandomMatrix<double, localFunctionValueSize, gridDim>();
-    /// Rebind local function to second order dual number
-    auto lfDual2nd                   = lf.rebindClone(dual2nd());
+    /// Rebind local function to second order dual number, the clone is reused for all integration points
+    auto& lfDual2nd                  = reusableRebindClone(lf, dual2nd());
     auto lfDual2ndLeafNodeCollection = collectLeafNodeLocalFunctions(lfDual2nd);
 
     auto localFdual2nd = [&](const auto& x) {
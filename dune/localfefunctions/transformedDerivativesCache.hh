@@ -0,0 +1,106 @@
+// SPDX-FileCopyrightText: 2022 The dune-localfefunction developers mueller@ibb.uni-stuttgart.de
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <typeindex>
+
+#include <dune/localfefunctions/eigenDuneTransformations.hh>
+
+namespace Dune {
+
+  /** \brief Storage of the ansatz function derivatives transformed to the grid element.
+   *
+   * The stored derivatives remember for which integration point, binding of the basis, geometry and transformation
+   * functor they were computed. Thus, repeated evaluations at the same integration point skip the transformation. Leaf
+   * nodes with the same basis and geometry can share one instance, see shareDerivativeTransformations().
+   */
+  template <typename AnsatzFunctionJacobian>
+  class TransformedDerivativesCache {
+  public:
+    explicit TransformedDerivativesCache(std::size_t numberOfAnsatzFunctions) {
+      resize(dNTransformed, numberOfAnsatzFunctions);
+    }
+
+    /** \brief Returns true if the stored derivatives are already transformed for the given integration point index */
+    template <typename Geometry, typename TransformFunctor>
+    bool isTransformedFor(long unsigned ipIndex, std::uint64_t basisBinding, const Geometry* geometry,
+                          const TransformFunctor&) const {
+      return key and key->ipIndex == ipIndex and key->basisBinding == basisBinding and key->geometry == geometry
+             and key->transformation == std::type_index(typeid(TransformFunctor));
+    }
+
+    /** \brief Marks the stored derivatives as transformed for the given integration point index */
+    template <typename Geometry, typename TransformFunctor>
+    void setTransformedFor(long unsigned ipIndex, std::uint64_t basisBinding, const Geometry* geometry,
+                           const TransformFunctor&) {
+      key = Key{ipIndex, basisBinding, geometry, std::type_index(typeid(TransformFunctor))};
+    }
+
+    /** \brief Marks the stored derivatives as not belonging to any integration point, e.g. after evaluating at an
+     * arbitrary local coordinate */
+    void invalidate() { key.reset(); }
+
+    AnsatzFunctionJacobian& derivatives() { return dNTransformed; }
+    const AnsatzFunctionJacobian& derivatives() const { return dNTransformed; }
+
+  private:
+    struct Key {
+      long unsigned ipIndex;
+      /* The integration rule is identified by CachedLocalBasis::bindingId() */
+      std::uint64_t basisBinding;
+      const void* geometry;
+      std::type_index transformation;
+    };
+
+    AnsatzFunctionJacobian dNTransformed;
+    std::optional<Key> key;
+  };
+
+  /** \brief The TransformedDerivativesCache of a leaf node.
+   *
+   * A copy of a leaf node gets its own copy of the cache, thus copies never share mutable state and can be used on
+   * different threads. The cache is only shared explicitly by shareWith(), see shareDerivativeTransformations(), and
+   * the sharing is kept if the leaf node is moved, e.g. into an expression. A moved-from storage has no cache and its
+   * copies have none either.
+   */
+  template <typename AnsatzFunctionJacobian>
+  class TransformedDerivativesStorage {
+    using Cache = TransformedDerivativesCache<AnsatzFunctionJacobian>;
+
+  public:
+    explicit TransformedDerivativesStorage(std::size_t numberOfAnsatzFunctions)
+        : cache{std::make_shared<Cache>(numberOfAnsatzFunctions)} {}
+
+    TransformedDerivativesStorage(const TransformedDerivativesStorage& other)
+        : cache{other.cache ? std::make_shared<Cache>(*other.cache) : nullptr} {}
+    TransformedDerivativesStorage& operator=(const TransformedDerivativesStorage& other) {
+      if (this != &other) cache = other.cache ? std::make_shared<Cache>(*other.cache) : nullptr;
+      return *this;
+    }
+    TransformedDerivativesStorage(TransformedDerivativesStorage&&) noexcept            = default;
+    TransformedDerivativesStorage& operator=(TransformedDerivativesStorage&&) noexcept = default;
+
+    /** \brief Uses the cache of other from now on */
+    void shareWith(const TransformedDerivativesStorage& other) { cache = other.cache; }
+
+    /** \brief Returns true if both use the same cache */
+    bool operator==(const TransformedDerivativesStorage& other) const { return cache == other.cache; }
+
+    Cache& operator*() const { return *cache; }
+    Cache* operator->() const { return cache.get(); }
+
+  private:
+    std::shared_ptr<Cache> cache;
+  };
+
+  /** \brief Creates a cache for the transformed derivatives of a leaf node with the given basis */
+  template <typename Basis>
+  auto makeTransformedDerivativesCache(const Basis& basis) {
+    return TransformedDerivativesStorage<typename Basis::JacobianType>(basis.size());
+  }
+
+}  // namespace Dune
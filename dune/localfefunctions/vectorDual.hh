@@ -0,0 +1,308 @@
+// SPDX-FileCopyrightText: 2022 The dune-localfefunction developers mueller@ibb.uni-stuttgart.de
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#pragma once
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <ostream>
+#include <type_traits>
+
+#include <dune/common/typetraits.hh>
+
+#include <Eigen/Core>
+
+namespace Dune {
+
+  /** \brief A forward mode automatic differentiation number, which carries the gradient w.r.t. several variables.
+   *
+   * In contrast to a dual number with a single derivative, an evaluation with VectorDual yields the derivatives w.r.t.
+   * all lanes variables at once. Thus, seeding each coefficient of a local function with its own lane, see
+   * seededRebindClone(), gives the whole gradient of an expression in a single evaluation. */
+  template <typename ScalarType, int lanes_>
+  class VectorDual {
+  public:
+    static constexpr int lanes = lanes_;
+    using Gradient             = std::array<ScalarType, lanes>;
+
+    VectorDual() : VectorDual(ScalarType(0)) {}
+
+    /** \brief Creates a constant, i.e. all derivatives vanish */
+    VectorDual(const ScalarType& val) : val_{val} { grad_.fill(ScalarType(0)); }
+
+    /** \brief Creates a constant from a number, e.g. from literals */
+    template <typename Number>
+      requires(std::is_arithmetic_v<Number> and not std::is_same_v<Number, ScalarType>)
+    VectorDual(const Number& val) : VectorDual(ScalarType(val)) {}
+
+    /** \brief Creates the independent variable with the given value, which is associated with the given lane */
+    static VectorDual variable(const ScalarType& val, int lane) {
+      VectorDual res(val);
+      res.grad_[lane] = ScalarType(1);
+      return res;
+    }
+
+    const ScalarType& value() const { return val_; }
+    ScalarType& value() { return val_; }
+
+    /** \brief The derivatives w.r.t. all lanes */
+    const Gradient& gradient() const { return grad_; }
+    Gradient& gradient() { return grad_; }
+
+    /** \brief The derivative w.r.t. the variable of the given lane */
+    const ScalarType& derivative(int lane) const { return grad_[lane]; }
+
+    /** \brief Explicit conversion to the value, e.g. for the conversion of the coefficients back to ScalarType */
+    explicit operator ScalarType() const { return val_; }
+
+    VectorDual& operator+=(const VectorDual& b) {
+      val_ += b.val_;
+      for (int i = 0; i < lanes; ++i)
+        grad_[i] += b.grad_[i];
+      return *this;
+    }
+
+    VectorDual& operator-=(const VectorDual& b) {
+      val_ -= b.val_;
+      for (int i = 0; i < lanes; ++i)
+        grad_[i] -= b.grad_[i];
+      return *this;
+    }
+
+    VectorDual& operator*=(const VectorDual& b) {
+      for (int i = 0; i < lanes; ++i)
+        grad_[i] = grad_[i] * b.val_ + val_ * b.grad_[i];
+      val_ *= b.val_;
+      return *this;
+    }
+
+    VectorDual& operator/=(const VectorDual& b) {
+      const ScalarType inv = ScalarType(1) / b.val_;
+      val_ *= inv;
+      for (int i = 0; i < lanes; ++i)
+        grad_[i] = (grad_[i] - val_ * b.grad_[i]) * inv;
+      return *this;
+    }
+
+    /* Scaling with a constant does not need the product rule */
+    VectorDual& operator+=(const ScalarType& b) {
+      val_ += b;
+      return *this;
+    }
+
+    VectorDual& operator-=(const ScalarType& b) {
+      val_ -= b;
+      return *this;
+    }
+
+    VectorDual& operator*=(const ScalarType& b) {
+      val_ *= b;
+      for (int i = 0; i < lanes; ++i)
+        grad_[i] *= b;
+      return *this;
+    }
+
+    VectorDual& operator/=(const ScalarType& b) { return *this *= ScalarType(1) / b; }
+
+    VectorDual operator-() const {
+      VectorDual res(*this);
+      res.val_ = -res.val_;
+      for (int i = 0; i < lanes; ++i)
+        res.grad_[i] = -res.grad_[i];
+      return res;
+    }
+
+    VectorDual operator+() const { return *this; }
+
+    friend VectorDual operator+(VectorDual a, const VectorDual& b) { return a += b; }
+    friend VectorDual operator-(VectorDual a, const VectorDual& b) { return a -= b; }
+    friend VectorDual operator*(VectorDual a, const VectorDual& b) { return a *= b; }
+    friend VectorDual operator/(VectorDual a, const VectorDual& b) { return a /= b; }
+
+    friend VectorDual operator+(VectorDual a, const ScalarType& b) { return a += b; }
+    friend VectorDual operator+(const ScalarType& a, VectorDual b) { return b += a; }
+    friend VectorDual operator-(VectorDual a, const ScalarType& b) { return a -= b; }
+    friend VectorDual operator-(const ScalarType& a, const VectorDual& b) { return -b + a; }
+    friend VectorDual operator*(VectorDual a, const ScalarType& b) { return a *= b; }
+    friend VectorDual operator*(const ScalarType& a, VectorDual b) { return b *= a; }
+    friend VectorDual operator/(VectorDual a, const ScalarType& b) { return a /= b; }
+    friend VectorDual operator/(const ScalarType& a, const VectorDual& b) { return VectorDual(a) / b; }
+
+    /* Literals are converted to ScalarType first, which keeps the operators unambiguous for nested numbers */
+    template <typename Number>
+      requires(std::is_arithmetic_v<Number> and not std::is_same_v<Number, ScalarType>)
+    friend VectorDual operator+(VectorDual a, const Number& b) {
+      return a += ScalarType(b);
+    }
+    template <typename Number>
+      requires(std::is_arithmetic_v<Number> and not std::is_same_v<Number, ScalarType>)
+    friend VectorDual operator+(const Number& a, VectorDual b) {
+      return b += ScalarType(a);
+    }
+    template <typename Number>
+      requires(std::is_arithmetic_v<Number> and not std::is_same_v<Number, ScalarType>)
+    friend VectorDual operator-(VectorDual a, const Number& b) {
+      return a -= ScalarType(b);
+    }
+    template <typename Number>
+      requires(std::is_arithmetic_v<Number> and not std::is_same_v<Number, ScalarType>)
+    friend VectorDual operator-(const Number& a, const VectorDual& b) {
+      return -b + ScalarType(a);
+    }
+    template <typename Number>
+      requires(std::is_arithmetic_v<Number> and not std::is_same_v<Number, ScalarType>)
+    friend VectorDual operator*(VectorDual a, const Number& b) {
+      return a *= ScalarType(b);
+    }
+    template <typename Number>
+      requires(std::is_arithmetic_v<Number> and not std::is_same_v<Number, ScalarType>)
+    friend VectorDual operator*(const Number& a, VectorDual b) {
+      return b *= ScalarType(a);
+    }
+    template <typename Number>
+      requires(std::is_arithmetic_v<Number> and not std::is_same_v<Number, ScalarType>)
+    friend VectorDual operator/(VectorDual a, const Number& b) {
+      return a /= ScalarType(b);
+    }
+    template <typename Number>
+      requires(std::is_arithmetic_v<Number> and not std::is_same_v<Number, ScalarType>)
+    friend VectorDual operator/(const Number& a, const VectorDual& b) {
+      return VectorDual(ScalarType(a)) / b;
+    }
+
+    /* Comparisons only consider the value, such that branches can be evaluated */
+    friend bool operator==(const VectorDual& a, const VectorDual& b) { return a.val_ == b.val_; }
+    friend bool operator!=(const VectorDual& a, const VectorDual& b) { return a.val_ != b.val_; }
+    friend bool operator<(const VectorDual& a, const VectorDual& b) { return a.val_ < b.val_; }
+    friend bool operator>(const VectorDual& a, const VectorDual& b) { return a.val_ > b.val_; }
+    friend bool operator<=(const VectorDual& a, const VectorDual& b) { return a.val_ <= b.val_; }
+    friend bool operator>=(const VectorDual& a, const VectorDual& b) { return a.val_ >= b.val_; }
+
+    friend std::ostream& operator<<(std::ostream& s, const VectorDual& a) { return s << a.val_; }
+
+    /** \brief The result of an outer function g with the derivative dg at the value of this number */
+    VectorDual compose(const ScalarType& g, const ScalarType& dg) const {
+      VectorDual res(*this);
+      res.val_ = g;
+      for (int i = 0; i < lanes; ++i)
+        res.grad_[i] *= dg;
+      return res;
+    }
+
+  private:
+    ScalarType val_;
+    Gradient grad_;
+  };
+
+  template <typename T>
+  struct IsVectorDual : std::false_type {};
+
+  template <typename ScalarType, int lanes>
+  struct IsVectorDual<VectorDual<ScalarType, lanes>> : std::true_type {};
+
+  template <typename ScalarType, int lanes>
+  struct IsNumber<VectorDual<ScalarType, lanes>> : public std::true_type {};
+
+  template <typename ScalarType, int lanes>
+  const ScalarType& val(const VectorDual<ScalarType, lanes>& a) {
+    return a.value();
+  }
+
+  template <typename ScalarType, int lanes>
+  VectorDual<ScalarType, lanes> exp(const VectorDual<ScalarType, lanes>& a) {
+    using std::exp;
+    const ScalarType e = exp(a.value());
+    return a.compose(e, e);
+  }
+
+  template <typename ScalarType, int lanes>
+  VectorDual<ScalarType, lanes> log(const VectorDual<ScalarType, lanes>& a) {
+    using std::log;
+    return a.compose(log(a.value()), ScalarType(1) / a.value());
+  }
+
+  template <typename ScalarType, int lanes>
+  VectorDual<ScalarType, lanes> sqrt(const VectorDual<ScalarType, lanes>& a) {
+    using std::sqrt;
+    const ScalarType s = sqrt(a.value());
+    return a.compose(s, ScalarType(0.5) / s);
+  }
+
+  template <typename ScalarType, int lanes, typename Number>
+    requires(std::is_arithmetic_v<Number> or std::is_same_v<Number, ScalarType>)
+  VectorDual<ScalarType, lanes> pow(const VectorDual<ScalarType, lanes>& a, const Number& p) {
+    using std::pow;
+    const ScalarType q = ScalarType(p);
+    return a.compose(pow(a.value(), q), q * pow(a.value(), q - ScalarType(1)));
+  }
+
+  /* The derivative w.r.t. the exponent is only added if it does not vanish, since log(a) is not defined for a <= 0 */
+  template <typename ScalarType, int lanes>
+  VectorDual<ScalarType, lanes> pow(const VectorDual<ScalarType, lanes>& a, const VectorDual<ScalarType, lanes>& p) {
+    using std::log;
+    auto res          = pow(a, p.value());
+    const auto& gradP = p.gradient();
+    if (std::ranges::any_of(gradP, [](const ScalarType& d) { return d != ScalarType(0); })) {
+      const ScalarType factor = res.value() * log(a.value());
+      for (int i = 0; i < lanes; ++i)
+        res.gradient()[i] += factor * gradP[i];
+    }
+    return res;
+  }
+
+  template <typename ScalarType, int lanes>
+  VectorDual<ScalarType, lanes> sin(const VectorDual<ScalarType, lanes>& a) {
+    using std::cos;
+    using std::sin;
+    return a.compose(sin(a.value()), cos(a.value()));
+  }
+
+  template <typename ScalarType, int lanes>
+  VectorDual<ScalarType, lanes> cos(const VectorDual<ScalarType, lanes>& a) {
+    using std::cos;
+    using std::sin;
+    return a.compose(cos(a.value()), -sin(a.value()));
+  }
+
+  template <typename ScalarType, int lanes>
+  VectorDual<ScalarType, lanes> tanh(const VectorDual<ScalarType, lanes>& a) {
+    using std::tanh;
+    const ScalarType t = tanh(a.value());
+    return a.compose(t, ScalarType(1) - t * t);
+  }
+
+  template <typename ScalarType, int lanes>
+  VectorDual<ScalarType, lanes> abs(const VectorDual<ScalarType, lanes>& a) {
+    return a.value() < ScalarType(0) ? -a : a;
+  }
+
+}  // namespace Dune
+
+namespace Eigen {
+  template <typename ScalarType, int lanes>
+  struct NumTraits<Dune::VectorDual<ScalarType, lanes>> : NumTraits<ScalarType> {
+    using Real       = Dune::VectorDual<ScalarType, lanes>;
+    using NonInteger = Dune::VectorDual<ScalarType, lanes>;
+    using Nested     = Dune::VectorDual<ScalarType, lanes>;
+    using Literal    = Dune::VectorDual<ScalarType, lanes>;
+    enum {
+      IsComplex             = 0,
+      IsInteger             = 0,
+      IsSigned              = 1,
+      RequireInitialization = 1,
+      ReadCost              = lanes + 1,
+      AddCost               = lanes + 1,
+      MulCost               = 3 * lanes + 1
+    };
+  };
+
+  template <typename ScalarType, int lanes, typename BinaryOp>
+  struct ScalarBinaryOpTraits<Dune::VectorDual<ScalarType, lanes>, ScalarType, BinaryOp> {
+    using ReturnType = Dune::VectorDual<ScalarType, lanes>;
+  };
+
+  template <typename ScalarType, int lanes, typename BinaryOp>
+  struct ScalarBinaryOpTraits<ScalarType, Dune::VectorDual<ScalarType, lanes>, BinaryOp> {
+    using ReturnType = Dune::VectorDual<ScalarType, lanes>;
+  };
+}  // namespace Eigen